@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdint>
+
+static Vector<uint64_t> random_keys(size_t n, uint64_t seed)
+{
+    Vector<uint64_t> keys;
+    uint64_t x = seed;
+    for (size_t i = 0; i != n; i++)
+    {
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        keys.push_back(x);
+    }
+    return keys;
+}
+
+template <class Filter>
+static double false_positive_rate(Filter const &filter, Vector<uint64_t> const &absent)
+{
+    size_t hits = 0;
+    for (uint64_t key : absent)
+        hits += filter.contains(key);
+    return double(hits) / absent.size();
+}
+
+template <class Query>
+static double queries_per_second(size_t n, Query query)
+{ //? 取 3 次中最快的一次, 单位为百万次每秒
+    double best = 0;
+    for (int round = 0; round != 3; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        volatile size_t sink = query();
+        (void)sink;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double rate = n / seconds / 1e6;
+        best = rate > best ? rate : best;
+    }
+    return best;
+}
+
+TEST_CASE("filter false positive rate vs memory", "[bloom_filter][cuckoo_filter][benchmark]") {
+    size_t const n = 1 << 20;
+    auto keys = random_keys(n, 0x2545F4914F6CDD1Dull);
+    auto absent = random_keys(n, 0x9E3779B97F4A7C15ull);
+
+    std::cout << "false positive rate, " << n << " keys:\n"
+              << "  filter                     bits/key   fpr (%)\n";
+    for (size_t bits : {4, 8, 10, 12, 16, 24})
+    {
+        BlockedBloomFilter<uint64_t> bloom(n, bits);
+        bloom.insert_bulk(keys);
+        std::cout << "  BlockedBloomFilter" << std::setw(18) << std::fixed << std::setprecision(1)
+                  << bloom.memory_bytes() * 8.0 / n << std::setprecision(4) << std::setw(10)
+                  << false_positive_rate(bloom, absent) * 100 << "\n";
+    }
+    for (double load : {0.5, 0.75, 0.9, 0.95})
+    { //? 桶数取 2 的幂, 固定 n 个槽, 按装载率插入前若干个键
+        CuckooFilter<uint64_t> cuckoo(n * 19 / 20);
+        size_t m = size_t(cuckoo.capacity() * load);
+        for (size_t i = 0; i != m; i++)
+            cuckoo.insert(keys[i]);
+        std::cout << "  CuckooFilter (load " << std::setprecision(2) << cuckoo.load_factor() << ")"
+                  << std::setw(10) << std::setprecision(1) << cuckoo.memory_bytes() * 8.0 / m
+                  << std::setprecision(4) << std::setw(10) << false_positive_rate(cuckoo, absent) * 100 << "\n";
+    }
+}
+
+TEST_CASE("filter queries per second", "[bloom_filter][cuckoo_filter][benchmark]") {
+    //? 表远大于缓存, 查询以缓存未命中为主; 一半的查询键存在
+    size_t const n = 1 << 22;
+    auto keys = random_keys(n, 0x2545F4914F6CDD1Dull);
+    auto queries = random_keys(n / 2, 0x9E3779B97F4A7C15ull);
+    for (size_t i = 0; i != n / 2; i++)
+        queries.push_back(keys[i * 2]);
+
+    BlockedBloomFilter<uint64_t> bloom(n, 10);
+    bloom.insert_bulk(keys);
+    CuckooFilter<uint64_t> cuckoo(n);
+    cuckoo.insert_bulk(keys);
+    HashSet<uint64_t> set;
+    set.reserve(n);
+    for (uint64_t key : keys)
+        set.insert(key);
+    Vector<uint8_t> out;
+
+    auto bloom_single = [&] {
+        size_t found = 0;
+        for (uint64_t key : queries)
+            found += bloom.contains(key);
+        return found;
+    };
+    auto bloom_bulk = [&] { return bloom.contains_bulk(queries, out); };
+    auto cuckoo_single = [&] {
+        size_t found = 0;
+        for (uint64_t key : queries)
+            found += cuckoo.contains(key);
+        return found;
+    };
+    auto cuckoo_bulk = [&] { return cuckoo.contains_bulk(queries, out); };
+    auto set_single = [&] {
+        size_t found = 0;
+        for (uint64_t key : queries)
+            found += set.contains(key);
+        return found;
+    };
+
+    std::cout << "queries per second (M/s), " << n << " keys:\n" << std::fixed << std::setprecision(1)
+              << "  BlockedBloomFilter contains       " << queries_per_second(queries.size(), bloom_single) << "\n"
+              << "  BlockedBloomFilter contains_bulk  " << queries_per_second(queries.size(), bloom_bulk) << "\n"
+              << "  CuckooFilter contains             " << queries_per_second(queries.size(), cuckoo_single) << "\n"
+              << "  CuckooFilter contains_bulk        " << queries_per_second(queries.size(), cuckoo_bulk) << "\n"
+              << "  HashSet<uint64_t> contains        " << queries_per_second(queries.size(), set_single) << "\n";
+
+    BENCHMARK("BlockedBloomFilter contains 4M queries") {
+        return bloom_single();
+    };
+    BENCHMARK("BlockedBloomFilter contains_bulk 4M queries") {
+        return bloom_bulk();
+    };
+    BENCHMARK("CuckooFilter contains 4M queries") {
+        return cuckoo_single();
+    };
+    BENCHMARK("CuckooFilter contains_bulk 4M queries") {
+        return cuckoo_bulk();
+    };
+    BENCHMARK("HashSet<uint64_t> contains 4M queries") {
+        return set_single();
+    };
+}
@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <vector>
+#include <list>
+
+TEST_CASE("vector list compare", "[vector][list][benchmark]") {
+    constexpr int n = 1000000;
+
+    Vector<int> a(n, 1), b(n, 1);
+    std::vector<int> sa(n, 1), sb(n, 1);
+    Vector<unsigned char> ba(n, 1), bb(n, 1);
+    List<int> la(n, 1), lb(n, 1);
+
+    BENCHMARK("Vector<int> == 1M") {
+        return a == b;
+    };
+
+    BENCHMARK("std::vector<int> == 1M") {
+        return sa == sb;
+    };
+
+    BENCHMARK("Vector<int> <=> 1M") {
+        return a <=> b;
+    };
+
+    BENCHMARK("std::vector<int> <=> 1M") {
+        return sa <=> sb;
+    };
+
+    BENCHMARK("Vector<unsigned char> <=> 1M") {
+        return ba <=> bb;
+    };
+
+    BENCHMARK("List<int> == 1M") {
+        return la == lb;
+    };
+
+    BENCHMARK("List<int> <=> 1M") {
+        return la <=> lb;
+    };
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct LockedHashMap
+{ //? 对照组: 一把互斥锁保护的 HashMap
+    std::mutex m_mutex;
+    HashMap<uint64_t, uint64_t> m_map;
+
+    void insert_or_assign(uint64_t key, uint64_t val)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map.insert_or_assign(key, val);
+    }
+
+    bool contains(uint64_t key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_map.contains(key);
+    }
+};
+
+template <class Map>
+static size_t run_mixed(Map &map, int threads, int total, int write_percent, uint64_t keys)
+{ //? threads 个线程共执行 total 次操作, 其中 write_percent% 为写, 其余为读
+    int per_thread = total / threads;
+    std::vector<std::thread> pool;
+    std::vector<size_t> hits(threads, 0);
+    for (int t = 0; t != threads; t++)
+        pool.emplace_back([&, t] {
+            uint64_t x = 0x9E3779B97F4A7C15ull * (t + 1);
+            for (int i = 0; i != per_thread; i++)
+            {
+                x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+                uint64_t key = x % keys;
+                if ((int)(x >> 57) % 100 < write_percent)
+                    map.insert_or_assign(key, x);
+                else
+                    hits[t] += map.contains(key);
+            }
+        });
+    for (auto &t : pool)
+        t.join();
+    size_t sum = 0;
+    for (size_t h : hits)
+        sum += h;
+    return sum;
+}
+
+TEST_CASE("concurrent hash map scalability", "[concurrent_hash_map][benchmark]") {
+    constexpr int total = 1 << 18;
+    constexpr uint64_t keys = 1 << 16;
+
+    ConcurrentHashMap<uint64_t, uint64_t> sharded(keys);
+    LockedHashMap locked;
+    for (uint64_t k = 0; k < keys; k += 2)
+    {
+        sharded.insert_or_assign(k, k);
+        locked.insert_or_assign(k, k);
+    }
+
+    for (int write_percent : {1, 10, 50})
+        for (int threads : {1, 2, 4, 8, 16, 32, 64})
+        {
+            std::string suffix = std::to_string(write_percent) + "% writes " + std::to_string(threads) + " threads";
+            BENCHMARK("ConcurrentHashMap 256K ops " + suffix) {
+                return run_mixed(sharded, threads, total, write_percent, keys);
+            };
+            BENCHMARK("mutex + HashMap 256K ops " + suffix) {
+                return run_mixed(locked, threads, total, write_percent, keys);
+            };
+        }
+}
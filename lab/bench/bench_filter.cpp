@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <vector>
+
+TEST_CASE("vector list erase_if", "[vector][list][benchmark]") {
+    constexpr int n = 10000000;
+
+    Vector<int> base;
+    base.reserve(n);
+    for (int i = 0; i != n; i++)
+        base.push_back(i);
+
+    //? 选择率: 被删除元素所占的比例
+    for (int percent : {1, 50, 99}) {
+        auto pred = [percent](int x) { return (x * 2654435761u) % 100 < (unsigned)percent; };
+
+        BENCHMARK_ADVANCED("Vector<int> erase_if 10M, remove " + std::to_string(percent) + "%")(Catch::Benchmark::Chronometer meter) {
+            std::vector<Vector<int>> vecs(meter.runs(), base);
+            meter.measure([&](int i) { return erase_if(vecs[i], pred); });
+        };
+    }
+
+    BENCHMARK_ADVANCED("Vector<int> erase() loop 100K, remove 50%")(Catch::Benchmark::Chronometer meter) {
+        std::vector<Vector<int>> vecs(meter.runs(), Vector<int>(base.begin(), base.begin() + 100000));
+        meter.measure([&](int i) {
+            auto &vec = vecs[i];
+            for (auto it = vec.begin(); it != vec.end();)
+                if (*it % 2 == 0)
+                    it = vec.erase(it);
+                else
+                    ++it;
+            return vec.size();
+        });
+    };
+
+    List<int> lbase(base.begin(), base.end());
+    for (int percent : {1, 50, 99}) {
+        auto pred = [percent](int x) { return (x * 2654435761u) % 100 < (unsigned)percent; };
+
+        BENCHMARK_ADVANCED("List<int> erase_if 10M, remove " + std::to_string(percent) + "%")(Catch::Benchmark::Chronometer meter) {
+            std::vector<List<int>> lsts(meter.runs(), lbase);
+            meter.measure([&](int i) { return erase_if(lsts[i], pred); });
+        };
+    }
+}
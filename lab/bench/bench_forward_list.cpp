@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <random>
+#include <vector>
+#include <iostream>
+#include "counting_allocator.hpp"
+
+template <class Lst>
+static double bytes_per_element(int n)
+{ //? 用 CountingAllocator 统计建表期间申请的字节数
+    AllocationCounters::bytes = 0;
+    Lst lst;
+    for (int i = 0; i != n; i++)
+        lst.push_front(i);
+    return (double)AllocationCounters::bytes / n;
+}
+
+template <class Lst>
+static long long stack_churn(Lst &lst, int n)
+{ //? 栈式的进出: 连续压入 64 个再全部弹出
+    long long sum = 0;
+    for (int i = 0; i != n; i += 64)
+    {
+        for (int k = 0; k != 64; k++)
+            lst.push_front(i + k);
+        for (int k = 0; k != 64; k++)
+        {
+            sum += lst.front();
+            lst.pop_front();
+        }
+    }
+    return sum;
+}
+
+TEST_CASE("forward list vs list", "[forward_list][benchmark]") {
+    constexpr int n = 1000000;
+
+    //? 单个 int 元素的节点: List 为 2 个指针 + int 对齐到 24 字节, ForwardList 为 1 个指针 + int 对齐到 16 字节
+    double list_bytes = bytes_per_element<List<int, CountingAllocator<int>>>(n);
+    double forward_bytes = bytes_per_element<ForwardList<int, CountingAllocator<int>>>(n);
+    std::cout << "heap bytes per element:\n"
+              << "  List<int>         " << list_bytes << "\n"
+              << "  ForwardList<int>  " << forward_bytes << "\n";
+
+    List<int> lst;
+    ForwardList<int> flst;
+
+    BENCHMARK("push/pop front 1M List<int>") {
+        return stack_churn(lst, n);
+    };
+
+    BENCHMARK("push/pop front 1M ForwardList<int>") {
+        return stack_churn(flst, n);
+    };
+
+    std::mt19937 rng(3);
+    std::vector<int> keys(n);
+    for (int &key : keys)
+        key = (int)rng();
+    List<int> list_base(keys.begin(), keys.end());
+    ForwardList<int> forward_base(keys.begin(), keys.end());
+
+    BENCHMARK_ADVANCED("sort 1M List<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> lsts(meter.runs(), list_base);
+        meter.measure([&](int i) { lsts[i].sort(); });
+    };
+
+    BENCHMARK_ADVANCED("sort 1M ForwardList<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<ForwardList<int>> lsts(meter.runs(), forward_base);
+        meter.measure([&](int i) { lsts[i].sort(); });
+    };
+}
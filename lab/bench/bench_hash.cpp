@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <functional>
+
+template <class Hash>
+static uint64_t hash_all(std::vector<char> const &buf, size_t key_size, Hash hash)
+{ //? 把 buf 切成 key_size 字节的键依次哈希
+    uint64_t sum = 0;
+    for (size_t i = 0; i + key_size <= buf.size(); i += key_size)
+        sum += hash(std::string_view(buf.data() + i, key_size));
+    return sum;
+}
+
+template <class Hash>
+static double gigabytes_per_second(std::vector<char> const &buf, size_t key_size, Hash hash)
+{ //? 取 5 次中最快的一次
+    double best = 0;
+    for (int round = 0; round != 5; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        volatile uint64_t sink = hash_all(buf, key_size, hash);
+        (void)sink;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double rate = buf.size() / seconds / 1e9;
+        best = rate > best ? rate : best;
+    }
+    return best;
+}
+
+TEST_CASE("hash throughput", "[hash][benchmark]") {
+    //? 1MB 数据常驻缓存, 只衡量哈希计算本身
+    std::vector<char> buf(1 << 20);
+    uint64_t x = 1;
+    for (char &c : buf)
+    {
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        c = char(x);
+    }
+
+    auto ours = [](std::string_view s) { return hash_bytes(s); };
+    auto theirs = [](std::string_view s) { return std::hash<std::string_view>()(s); };
+
+    std::cout << "hash throughput (GB/s):\n"
+              << "  key bytes   hash_bytes   std::hash<string_view>\n";
+    for (size_t key_size : {4, 8, 16, 32, 64, 128, 256, 1024, 4096})
+        std::cout << "  " << std::setw(9) << key_size << std::fixed << std::setprecision(2)
+                  << std::setw(13) << gigabytes_per_second(buf, key_size, ours)
+                  << std::setw(25) << gigabytes_per_second(buf, key_size, theirs) << "\n";
+
+    for (size_t key_size : {8, 64, 4096})
+    {
+        std::string suffix = " 1MB in " + std::to_string(key_size) + "-byte keys";
+        BENCHMARK("hash_bytes" + suffix) {
+            return hash_all(buf, key_size, ours);
+        };
+        BENCHMARK("std::hash<string_view>" + suffix) {
+            return hash_all(buf, key_size, theirs);
+        };
+    }
+}
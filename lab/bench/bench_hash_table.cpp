@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <unordered_map>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+//? 命中键均为奇数, 未命中键均为偶数, 两组互不相交
+static std::vector<uint64_t> make_keys(size_t n, uint64_t seed, bool odd)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> keys(n);
+    for (auto &key : keys)
+        key = odd ? rng() | 1 : rng() & ~uint64_t(1);
+    return keys;
+}
+
+template <class Map>
+static Map build(std::vector<uint64_t> const &keys)
+{
+    Map map;
+    for (auto key : keys)
+        map[key] = key;
+    return map;
+}
+
+template <class Map>
+static size_t lookup(Map const &map, std::vector<uint64_t> const &keys)
+{
+    size_t found = 0;
+    for (auto key : keys)
+        found += map.find(key) != map.end();
+    return found;
+}
+
+template <class Map>
+static void bench_map(std::string const &name, size_t n)
+{
+    auto hits = make_keys(n, 1, true);
+    auto misses = make_keys(n, 2, false);
+    std::string suffix = " " + std::to_string(n) + " " + name;
+
+    BENCHMARK("insert" + suffix) {
+        return build<Map>(hits).size();
+    };
+
+    Map map = build<Map>(hits);
+
+    BENCHMARK("hit lookup" + suffix) {
+        return lookup(map, hits);
+    };
+
+    BENCHMARK("miss lookup" + suffix) {
+        return lookup(map, misses);
+    };
+
+    BENCHMARK_ADVANCED("erase" + suffix)(Catch::Benchmark::Chronometer meter) {
+        std::vector<Map> maps(meter.runs(), map);
+        meter.measure([&](int i) {
+            size_t erased = 0;
+            for (auto key : hits)
+                erased += maps[i].erase(key);
+            return erased;
+        });
+    };
+}
+
+//? 更大的规模 (如 1 亿) 只需在列表中追加, 注意 std::unordered_map 每个元素约 40 字节以上的内存
+TEST_CASE("hash map vs std::unordered_map", "[hash_table][benchmark]") {
+    for (size_t n : {size_t(1000), size_t(100000), size_t(1000000), size_t(10000000)})
+    {
+        bench_map<HashMap<uint64_t, uint64_t>>("HashMap", n);
+        bench_map<std::unordered_map<uint64_t, uint64_t>>("std::unordered_map", n);
+    }
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <list>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+template <class Lst>
+static long long queue_churn(Lst &lst, int n)
+{ //? 队列式的稳态进出: 每次尾部进一个, 头部出一个
+    long long sum = 0;
+    for (int i = 0; i != n; i++)
+    {
+        lst.push_back(i);
+        sum += lst.front();
+        lst.pop_front();
+    }
+    return sum;
+}
+
+template <class Lst>
+static void random_churn(Lst &lst, int n)
+{ //? 随机位置插入删除, 打散节点在堆上的分布
+    std::mt19937 rng(42);
+    auto it = lst.begin();
+    for (int i = 0; i != n; i++)
+    {
+        if (it == lst.end())
+            it = lst.begin();
+        if (rng() % 2)
+            it = lst.insert(it, i);
+        else if (lst.size() > 1 && it != lst.end())
+            it = lst.erase(it);
+        for (unsigned k = rng() % 8; k != 0 && it != lst.end(); k--)
+            ++it;
+    }
+}
+
+template <class Lst>
+static long long traverse(Lst const &lst)
+{
+    long long sum = 0;
+    for (auto it = lst.begin(); it != lst.end(); ++it)
+        sum += *it;
+    return sum;
+}
+
+TEST_CASE("list node pool", "[list][benchmark]") {
+    constexpr int n = 1000000;
+
+    List<int> plain(1024, 1);
+    List<int, PoolAllocator<int>> pooled(1024, 1);
+
+    BENCHMARK("queue churn 1M List<int>") {
+        return queue_churn(plain, n);
+    };
+
+    BENCHMARK("queue churn 1M List<int, PoolAllocator>") {
+        return queue_churn(pooled, n);
+    };
+
+    List<int> plain_big;
+    List<int, PoolAllocator<int>> pooled_big;
+    for (int i = 0; i != n; i++) {
+        plain_big.push_back(i);
+        pooled_big.push_back(i);
+    }
+    random_churn(plain_big, n);
+    random_churn(pooled_big, n);
+
+    BENCHMARK("traverse 1M after churn List<int>") {
+        return traverse(plain_big);
+    };
+
+    BENCHMARK("traverse 1M after churn List<int, PoolAllocator>") {
+        return traverse(pooled_big);
+    };
+}
+
+TEST_CASE("list sort", "[list][benchmark]") {
+    constexpr int n = 1000000;
+
+    std::mt19937 rng(7);
+    std::vector<int> keys(n);
+    for (int &key : keys)
+        key = (int)rng();
+    List<int> base(keys.begin(), keys.end());
+
+    BENCHMARK_ADVANCED("List<int>::sort 1M (relink)")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> lsts(meter.runs(), base);
+        meter.measure([&](int i) { lsts[i].sort(); });
+    };
+
+    BENCHMARK_ADVANCED("List<int> copy-sort-rebuild 1M")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> lsts(meter.runs(), base);
+        meter.measure([&](int i) {
+            std::vector<int> tmp(lsts[i].begin(), lsts[i].end());
+            std::sort(tmp.begin(), tmp.end());
+            lsts[i].assign(tmp.begin(), tmp.end());
+        });
+    };
+
+    std::list<int> std_base(keys.begin(), keys.end());
+    BENCHMARK_ADVANCED("std::list<int>::sort 1M")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::list<int>> lsts(meter.runs(), std_base);
+        meter.measure([&](int i) { lsts[i].sort(); });
+    };
+}
+
+TEST_CASE("list compact", "[list][benchmark]") {
+    constexpr int n = 1000000;
+
+    List<int> plain;
+    List<int, PoolAllocator<int>> pooled;
+    for (int i = 0; i != n; i++) {
+        plain.push_back(i);
+        pooled.push_back(i);
+    }
+    random_churn(plain, n);
+    random_churn(pooled, n);
+
+    BENCHMARK("traverse 1M scattered List<int>") {
+        return traverse(plain);
+    };
+
+    BENCHMARK("traverse 1M scattered List<int, PoolAllocator>") {
+        return traverse(pooled);
+    };
+
+    BENCHMARK_ADVANCED("compact 1M List<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> lsts(meter.runs(), plain);
+        meter.measure([&](int i) { lsts[i].compact(); });
+    };
+
+    plain.compact();
+    pooled.compact();
+
+    BENCHMARK("traverse 1M compacted List<int>") {
+        return traverse(plain);
+    };
+
+    BENCHMARK("traverse 1M compacted List<int, PoolAllocator>") {
+        return traverse(pooled);
+    };
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string>
+
+struct LockedListQueue
+{ //? 对照组: 互斥锁保护的 List
+    std::mutex m_mutex;
+    List<int> m_list;
+
+    void push(int val)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_list.push_back(val);
+    }
+
+    template <class Func>
+    size_t drain(Func func)
+    {
+        List<int> batch;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            batch.splice(batch.end(), m_list);
+        }
+        for (int val : batch)
+            func(val);
+        return batch.size();
+    }
+};
+
+template <class Queue>
+static long long run_producers(int producers, int total)
+{ //? producers 个线程共投递 total 个元素, 当前线程作为消费者全部取出
+    Queue q;
+    int per_producer = total / producers;
+    std::vector<std::thread> threads;
+    for (int p = 0; p != producers; p++)
+        threads.emplace_back([&] {
+            for (int i = 0; i != per_producer; i++)
+                q.push(i);
+        });
+    long long sum = 0;
+    size_t received = 0;
+    while (received != (size_t)per_producer * producers)
+        received += q.drain([&](int val) { sum += val; });
+    for (auto &t : threads)
+        t.join();
+    return sum;
+}
+
+TEST_CASE("mpsc queue vs locked list", "[mpsc_queue][benchmark]") {
+    constexpr int total = 1 << 18;
+
+    for (int producers : {1, 2, 4, 8, 16, 32})
+    {
+        std::string suffix = std::to_string(producers) + " producers";
+        BENCHMARK("MpscQueue<int> 256K items " + suffix) {
+            return run_producers<MpscQueue<int>>(producers, total);
+        };
+        BENCHMARK("mutex + List<int> 256K items " + suffix) {
+            return run_producers<LockedListQueue>(producers, total);
+        };
+    }
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include "counting_allocator.hpp"
+
+//? 模拟每个请求里生命周期很短的小向量: 构造, 追加 k 个元素, 求和后销毁
+template <class Vec>
+static long long short_lived(int requests, int k)
+{
+    long long sum = 0;
+    for (int r = 0; r != requests; r++)
+    {
+        Vec vec;
+        for (int i = 0; i != k; i++)
+            vec.push_back(r + i);
+        for (int x : vec)
+            sum += x;
+    }
+    return sum;
+}
+
+TEST_CASE("small vector vs vector", "[small_vector][benchmark]") {
+    constexpr int requests = 100000;
+
+    for (int k : {4, 8, 16}) {
+        CountingAllocator<int>::allocations = 0;
+        short_lived<Vector<int, CountingAllocator<int>>>(requests, k);
+        size_t vec_allocs = CountingAllocator<int>::allocations;
+        CountingAllocator<int>::allocations = 0;
+        short_lived<SmallVector<int, 8, CountingAllocator<int>>>(requests, k);
+        size_t small_allocs = CountingAllocator<int>::allocations;
+        std::cout << "allocations for " << requests << " vectors of " << k << " elements: "
+                  << "Vector " << vec_allocs << ", SmallVector<int, 8> " << small_allocs << "\n";
+    }
+
+    BENCHMARK("100K short-lived Vector<int> x6") {
+        return short_lived<Vector<int>>(requests, 6);
+    };
+
+    BENCHMARK("100K short-lived SmallVector<int, 8> x6") {
+        return short_lived<SmallVector<int, 8>>(requests, 6);
+    };
+
+    BENCHMARK("100K short-lived Vector<int> x16") {
+        return short_lived<Vector<int>>(requests, 16);
+    };
+
+    BENCHMARK("100K short-lived SmallVector<int, 8> x16") {
+        return short_lived<SmallVector<int, 8>>(requests, 16);
+    };
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <random>
+
+//? 在编译期生成 N 个长度不一的字段名, 存在静态存储中供 string_view 引用
+template <size_t N>
+struct FieldNames
+{
+    static constexpr size_t max_len = 32;
+    char m_chars[N][max_len]{};
+    size_t m_lens[N]{};
+
+    constexpr FieldNames()
+    {
+        constexpr std::string_view prefixes[] = {"id_", "user_name_", "created_at_", "x", "request_header_field_"};
+        for (size_t i = 0; i != N; i++)
+        {
+            std::string_view prefix = prefixes[i % 5];
+            size_t len = 0;
+            for (char c : prefix)
+                m_chars[i][len++] = c;
+            char digits[8]{};
+            size_t n = 0;
+            for (size_t v = i; n == 0 || v != 0; v /= 10)
+                digits[n++] = char('0' + v % 10);
+            while (n != 0)
+                m_chars[i][len++] = digits[--n];
+            m_lens[i] = len;
+        }
+    }
+
+    constexpr std::string_view operator[](size_t i) const
+    {
+        return {m_chars[i], m_lens[i]};
+    }
+};
+
+template <size_t N>
+static constexpr FieldNames<N> field_names{};
+
+template <size_t N>
+static constexpr StaticMap<std::string_view, int, N> field_map = []() consteval
+{
+    std::array<std::pair<std::string_view, int>, N> arr{};
+    for (size_t i = 0; i != N; i++)
+        arr[i] = {field_names<N>[i], int(i)};
+    return StaticMap<std::string_view, int, N>(arr);
+}();
+
+template <size_t N>
+static void bench_lookup()
+{
+    HashMap<std::string_view, int> dynamic;
+    std::vector<std::string_view> queries;
+    for (size_t i = 0; i != N; i++)
+    {
+        dynamic.insert_or_assign(field_names<N>[i], int(i));
+        queries.push_back(field_names<N>[i]);
+    }
+    //? 一半命中一半未命中, 查询顺序随机
+    std::vector<std::string> misses;
+    for (size_t i = 0; i != N; i++)
+        misses.push_back("missing_" + std::to_string(i));
+    for (auto const &s : misses)
+        queries.push_back(s);
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(42));
+
+    std::string suffix = " " + std::to_string(N) + " string keys, " + std::to_string(queries.size()) + " lookups";
+    BENCHMARK("StaticMap" + suffix) {
+        long sum = 0;
+        for (auto q : queries)
+        {
+            auto it = field_map<N>.find(q);
+            sum += it != field_map<N>.end() ? it->second : -1;
+        }
+        return sum;
+    };
+    BENCHMARK("HashMap<std::string_view, int>" + suffix) {
+        long sum = 0;
+        for (auto q : queries)
+        {
+            auto it = dynamic.find(q);
+            sum += it != dynamic.end() ? it->second : -1;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("static map vs HashMap lookup", "[static_map][benchmark]") {
+    bench_lookup<50>();
+    bench_lookup<500>();
+    bench_lookup<5000>();
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+static std::vector<uint64_t> churn_keys(size_t n)
+{
+    std::vector<uint64_t> keys(n);
+    uint64_t x = 0x2545F4914F6CDD1Dull;
+    for (auto &k : keys)
+    {
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        k = x;
+    }
+    return keys;
+}
+
+template <class Map>
+static size_t run_churn(std::vector<uint64_t> const &keys, size_t live)
+{ //? 表中始终保持 live 个元素: 每插入一个新键就删除最早插入的键
+    Map map;
+    for (size_t i = 0; i != live; i++)
+        map[keys[i]] = i;
+    for (size_t i = live; i != keys.size(); i++)
+    {
+        map[keys[i]] = i;
+        map.erase(keys[i - live]);
+    }
+    return map.size();
+}
+
+TEST_CASE("unordered map insert/erase churn", "[unordered_map][benchmark]") {
+    for (size_t live : {size_t(1) << 10, size_t(1) << 14, size_t(1) << 18})
+    {
+        auto keys = churn_keys(live + (1 << 20));
+        std::string suffix = " live=" + std::to_string(live) + " 1M churn";
+        BENCHMARK("UnorderedMap<uint64_t, uint64_t> (pool)" + suffix) {
+            return run_churn<UnorderedMap<uint64_t, uint64_t>>(keys, live);
+        };
+        BENCHMARK("UnorderedMap<uint64_t, uint64_t> (std::allocator)" + suffix) {
+            return run_churn<UnorderedMap<uint64_t, uint64_t, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                          std::allocator<std::pair<uint64_t const, uint64_t>>>>(keys, live);
+        };
+        BENCHMARK("std::unordered_map<uint64_t, uint64_t>" + suffix) {
+            return run_churn<std::unordered_map<uint64_t, uint64_t>>(keys, live);
+        };
+    }
+}
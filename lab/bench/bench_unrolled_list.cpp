@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <random>
+#include <vector>
+#include <iterator>
+
+template <class Lst>
+static void scatter(Lst &lst, int n)
+{ //? 随机位置插入删除, 模拟长期运行后的链表
+    std::mt19937 rng(42);
+    auto it = lst.begin();
+    for (int i = 0; i != n; i++)
+    {
+        if (it == lst.end())
+            it = lst.begin();
+        if (rng() % 2)
+            it = lst.insert(it, i);
+        else if (lst.size() > 1 && it != lst.end())
+            it = lst.erase(it);
+        for (unsigned k = rng() % 8; k != 0 && it != lst.end(); k--)
+            ++it;
+    }
+}
+
+template <class Lst>
+static long long traverse(Lst const &lst)
+{
+    long long sum = 0;
+    for (auto it = lst.begin(); it != lst.end(); ++it)
+        sum += *it;
+    return sum;
+}
+
+template <class Lst>
+static size_t middle_insert(Lst &lst, int n)
+{ //? 固定在中间位置附近连续插入
+    auto mid = std::next(lst.begin(), lst.size() / 2);
+    for (int i = 0; i != n; i++)
+        mid = lst.insert(mid, i);
+    return lst.size();
+}
+
+template <class Lst>
+static size_t erase_every_other(Lst &lst)
+{
+    for (auto it = lst.begin(); it != lst.end();)
+    {
+        it = lst.erase(it);
+        if (it != lst.end())
+            ++it;
+    }
+    return lst.size();
+}
+
+TEST_CASE("unrolled list vs list", "[unrolled_list][benchmark]") {
+    constexpr int n = 1000000;
+
+    List<int> list_seq;
+    UnrolledList<int> unrolled_seq;
+    for (int i = 0; i != n; i++)
+    {
+        list_seq.push_back(i);
+        unrolled_seq.push_back(i);
+    }
+
+    BENCHMARK("traverse 1M List<int>") {
+        return traverse(list_seq);
+    };
+
+    BENCHMARK("traverse 1M UnrolledList<int>") {
+        return traverse(unrolled_seq);
+    };
+
+    List<int> list_aged(list_seq);
+    UnrolledList<int> unrolled_aged(unrolled_seq);
+    scatter(list_aged, n);
+    scatter(unrolled_aged, n);
+
+    BENCHMARK("traverse after churn List<int>") {
+        return traverse(list_aged);
+    };
+
+    BENCHMARK("traverse after churn UnrolledList<int>") {
+        return traverse(unrolled_aged);
+    };
+
+    BENCHMARK_ADVANCED("middle insert 100K List<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> runs(meter.runs(), List<int>(1000, 0));
+        meter.measure([&](int i) { return middle_insert(runs[i], 100000); });
+    };
+
+    BENCHMARK_ADVANCED("middle insert 100K UnrolledList<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<UnrolledList<int>> runs(meter.runs(), UnrolledList<int>(1000, 0));
+        meter.measure([&](int i) { return middle_insert(runs[i], 100000); });
+    };
+
+    BENCHMARK_ADVANCED("erase every other 100K List<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<List<int>> runs(meter.runs(), List<int>(100000, 1));
+        meter.measure([&](int i) { return erase_every_other(runs[i]); });
+    };
+
+    BENCHMARK_ADVANCED("erase every other 100K UnrolledList<int>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<UnrolledList<int>> runs(meter.runs(), UnrolledList<int>(100000, 1));
+        meter.measure([&](int i) { return erase_every_other(runs[i]); });
+    };
+}
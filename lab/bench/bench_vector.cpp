@@ -0,0 +1,165 @@
+#include <iostream>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <miniSTL/stl.hpp>
+#include <vector>
+#include "counting_allocator.hpp"
+
+template <class Growth>
+static size_t count_reallocations(size_t n)
+{
+    CountingAllocator<int>::allocations = 0;
+    Vector<int, CountingAllocator<int>, Growth> vec;
+    for (size_t i = 0; i != n; i++)
+        vec.push_back((int)i);
+    return CountingAllocator<int>::allocations;
+}
+
+TEST_CASE("vector growth policy", "[vector][benchmark]") {
+    constexpr size_t n = 1000000;
+
+    std::cout << "reallocations per 1M push_back:\n"
+              << "  GrowthDouble      " << count_reallocations<GrowthDouble>(n) << "\n"
+              << "  GrowthOneAndHalf  " << count_reallocations<GrowthOneAndHalf>(n) << "\n"
+              << "  GrowthChunk<4096> " << count_reallocations<GrowthChunk<4096>>(n) << "\n";
+
+    BENCHMARK("push_back 1M GrowthDouble") {
+        Vector<int, std::allocator<int>, GrowthDouble> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back((int)i);
+        return vec.size();
+    };
+
+    BENCHMARK("push_back 1M GrowthOneAndHalf") {
+        Vector<int, std::allocator<int>, GrowthOneAndHalf> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back((int)i);
+        return vec.size();
+    };
+
+    BENCHMARK("push_back 1M GrowthChunk<4096>") {
+        Vector<int, std::allocator<int>, GrowthChunk<4096>> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back((int)i);
+        return vec.size();
+    };
+
+    BENCHMARK("push_back 1M std::vector") {
+        std::vector<int> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back((int)i);
+        return vec.size();
+    };
+}
+
+struct Pod16
+{
+    long long a, b;
+};
+
+struct NonTrivial16
+{ //* 用户提供的拷贝构造使其不可平凡复制, 走逐元素搬迁的慢路径
+    long long a, b;
+
+    NonTrivial16(long long a, long long b) : a(a), b(b) {}
+    NonTrivial16(NonTrivial16 const &that) : a(that.a), b(that.b) {}
+    NonTrivial16 &operator=(NonTrivial16 const &that)
+    {
+        a = that.a;
+        b = that.b;
+        return *this;
+    }
+};
+
+TEST_CASE("vector trivially relocatable insert", "[vector][benchmark]") {
+    constexpr int n = 20000;
+
+    BENCHMARK("insert middle 20K Pod16 (memmove)") {
+        Vector<Pod16> vec;
+        for (int i = 0; i != n; i++)
+            vec.insert(vec.begin() + vec.size() / 2, Pod16{i, i});
+        return vec.size();
+    };
+
+    BENCHMARK("insert middle 20K NonTrivial16 (loop)") {
+        Vector<NonTrivial16> vec;
+        for (int i = 0; i != n; i++)
+            vec.insert(vec.begin() + vec.size() / 2, NonTrivial16{i, i});
+        return vec.size();
+    };
+
+    BENCHMARK("erase front 20K Pod16 (memmove)") {
+        Vector<Pod16> vec(n, Pod16{1, 2});
+        while (!vec.empty())
+            vec.erase(vec.begin());
+        return vec.size();
+    };
+
+    BENCHMARK("erase front 20K NonTrivial16 (loop)") {
+        Vector<NonTrivial16> vec(n, NonTrivial16{1, 2});
+        while (!vec.empty())
+            vec.erase(vec.begin());
+        return vec.size();
+    };
+}
+
+TEST_CASE("vector bulk fill", "[vector][benchmark]") {
+    constexpr size_t n = 64 << 20; //? 256MB 的 float 缓冲区
+
+    BENCHMARK("Vector<float>(n) 64M") {
+        Vector<float> vec(n);
+        return vec.size();
+    };
+
+    BENCHMARK("Vector<float>(n, 1.0f) 64M") {
+        Vector<float> vec(n, 1.0f);
+        return vec.size();
+    };
+
+    BENCHMARK("resize_for_overwrite 64M") {
+        Vector<float> vec;
+        vec.resize_for_overwrite(n);
+        return vec.size();
+    };
+
+    BENCHMARK("std::vector<float>(n) 64M") {
+        std::vector<float> vec(n);
+        return vec.size();
+    };
+}
+
+TEST_CASE("vector mremap growth", "[vector][benchmark]") {
+    constexpr size_t n = 64 << 20; //? 最终 512MB 的 uint64_t
+
+    BENCHMARK("push_back 64M uint64_t std::allocator") {
+        Vector<uint64_t> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back(i);
+        return vec.size();
+    };
+
+    BENCHMARK("push_back 64M uint64_t MmapAllocator") {
+        Vector<uint64_t, MmapAllocator<uint64_t>> vec;
+        for (size_t i = 0; i != n; i++)
+            vec.push_back(i);
+        return vec.size();
+    };
+
+    BENCHMARK_ADVANCED("shrink_to_fit + reserve 256MB <-> 512MB std::allocator")(Catch::Benchmark::Chronometer meter) {
+        Vector<uint64_t> vec(n / 2, 1);
+        meter.measure([&] {
+            vec.shrink_to_fit();
+            vec.reserve(n);
+            return vec.capacity();
+        });
+    };
+
+    BENCHMARK_ADVANCED("shrink_to_fit + reserve 256MB <-> 512MB MmapAllocator")(Catch::Benchmark::Chronometer meter) {
+        Vector<uint64_t, MmapAllocator<uint64_t>> vec(n / 2, 1);
+        meter.measure([&] {
+            vec.shrink_to_fit();
+            vec.reserve(n);
+            return vec.capacity();
+        });
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+//? 计数放在非模板基类中, rebind 到节点类型后仍累加到同一组计数
+struct AllocationCounters
+{
+    static inline size_t allocations = 0;
+    static inline size_t bytes = 0;
+};
+
+//? 统计 allocate 次数与累计字节数的分配器, 用来观察容器的堆分配次数与内存占用
+template <class T>
+struct CountingAllocator : std::allocator<T>, AllocationCounters
+{
+    template <class U>
+    struct rebind
+    {
+        using other = CountingAllocator<U>;
+    };
+
+    CountingAllocator() = default;
+
+    template <class U>
+    CountingAllocator(CountingAllocator<U> const &) {}
+
+    T *allocate(size_t n)
+    {
+        ++allocations;
+        bytes += n * sizeof(T);
+        return std::allocator<T>::allocate(n);
+    }
+};
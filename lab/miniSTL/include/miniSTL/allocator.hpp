@@ -0,0 +1,444 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <limits>
+#include <memory>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+//?                             映射分配器 MmapAllocator  目的：超大缓冲区扩容时重映射页表而不复制数据
+//?   不小于 MmapThreshold 字节的块直接向内核 mmap, 扩容时用 mremap 把原有的页挪到新地址
+//?   更小的块走 malloc/realloc; 非 Linux 平台上 reallocate 退化为 "分配 + memcpy + 释放"
+//?   额外提供 reallocate(p, old_n, new_n), Vector 对可平凡重定位的元素会优先使用它
+template <class T, size_t MmapThreshold = (size_t(1) << 20)>
+struct MmapAllocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "MmapAllocator: over-aligned types are not supported");
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    template <class U>
+    struct rebind
+    {
+        using other = MmapAllocator<U, MmapThreshold>;
+    };
+
+    MmapAllocator() = default;
+
+    template <class U>
+    MmapAllocator(MmapAllocator<U, MmapThreshold> const &) noexcept {}
+
+    static constexpr size_t max_size() noexcept
+    {
+        return std::numeric_limits<size_t>::max() / sizeof(T);
+    }
+
+    static bool is_mapped(size_t n) noexcept
+    { //* 按块大小判断是否走 mmap, 分配和释放时的 n 一致, 所以无需额外记录
+#if defined(__linux__)
+        return n * sizeof(T) >= MmapThreshold;
+#else
+        return false;
+#endif
+    }
+
+    T *allocate(size_t n)
+    {
+        if (n > max_size()) [[unlikely]]
+            throw std::bad_array_new_length();
+        size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+        if (is_mapped(n))
+        {
+            void *p = ::mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) [[unlikely]]
+                throw std::bad_alloc();
+            return static_cast<T *>(p);
+        }
+#endif
+        void *p = std::malloc(bytes != 0 ? bytes : 1);
+        if (p == NULL) [[unlikely]]
+            throw std::bad_alloc();
+        return static_cast<T *>(p);
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+#if defined(__linux__)
+        if (is_mapped(n))
+        {
+            ::munmap(p, n * sizeof(T));
+            return;
+        }
+#endif
+        std::free(p);
+    }
+
+    T *reallocate(T *p, size_t old_n, size_t new_n)
+    { //? 按字节搬迁前 min(old_n, new_n) 个元素, 只适用于可平凡重定位的类型
+        if (new_n > max_size()) [[unlikely]]
+            throw std::bad_array_new_length();
+        bool old_mapped = is_mapped(old_n);
+        bool new_mapped = is_mapped(new_n);
+#if defined(__linux__)
+        if (old_mapped && new_mapped)
+        { //* 内核只改页表, 峰值内存约 1 倍, 耗时与页数成正比
+            void *q = ::mremap(p, old_n * sizeof(T), new_n * sizeof(T), MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) [[unlikely]]
+                throw std::bad_alloc();
+            return static_cast<T *>(q);
+        }
+#endif
+        if (!old_mapped && !new_mapped)
+        {
+            void *q = std::realloc(p, new_n != 0 ? new_n * sizeof(T) : 1);
+            if (q == NULL) [[unlikely]]
+                throw std::bad_alloc();
+            return static_cast<T *>(q);
+        }
+        T *q = allocate(new_n);
+        std::memcpy(static_cast<void *>(q), static_cast<void const *>(p),
+                    (old_n < new_n ? old_n : new_n) * sizeof(T));
+        deallocate(p, old_n);
+        return q;
+    }
+
+    template <class U>
+    bool operator==(MmapAllocator<U, MmapThreshold> const &) const noexcept
+    {
+        return true;
+    }
+};
+
+//?                             对齐分配器 AlignedAllocator  目的：保证缓冲区首地址按 Align 字节对齐
+//?   SIMD 内核可对 Vector::data() 使用对齐加载; Align 必须是 2 的幂且不小于 alignof(T)
+template <class T, size_t Align = 64>
+struct AlignedAllocator
+{
+    static_assert((Align & (Align - 1)) == 0, "AlignedAllocator: Align must be a power of two");
+    static_assert(Align >= alignof(T), "AlignedAllocator: Align must not be less than alignof(T)");
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    static constexpr size_t alignment = Align; //* 所分配的每一块都保证的对齐字节数
+
+    template <class U>
+    struct rebind
+    { //? List 会把分配器重绑定到节点类型, 节点的对齐要求更高时取较大者
+        using other = AlignedAllocator<U, (Align > alignof(U) ? Align : alignof(U))>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <class U, size_t A>
+    AlignedAllocator(AlignedAllocator<U, A> const &) noexcept {}
+
+    T *allocate(size_t n)
+    {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) [[unlikely]]
+            throw std::bad_array_new_length();
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        ::operator delete(p, n * sizeof(T), std::align_val_t(Align));
+    }
+
+    template <class U, size_t A>
+    bool operator==(AlignedAllocator<U, A> const &) const noexcept
+    {
+        return true;
+    }
+};
+
+//?                             大页分配器 HugePageAllocator  目的：大表使用 2MB 页, 减少 TLB 缺失
+//?   不小于 2MB 的块按 2MB 对齐、长度取整到 2MB, 并以 madvise(MADV_HUGEPAGE) 请求透明大页
+//?   更小的块 (例如 List 的节点) 只按缓存行对齐分配, 因此 alignment 只承诺 64 字节
+template <class T>
+struct HugePageAllocator
+{
+    static_assert(alignof(T) <= 64, "HugePageAllocator: over-aligned types are not supported");
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    static constexpr size_t huge_page_size = size_t(2) << 20;
+    static constexpr size_t alignment = 64;
+
+    template <class U>
+    struct rebind
+    {
+        using other = HugePageAllocator<U>;
+    };
+
+    HugePageAllocator() = default;
+
+    template <class U>
+    HugePageAllocator(HugePageAllocator<U> const &) noexcept {}
+
+    static size_t _round_up(size_t bytes) noexcept
+    {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+
+    T *allocate(size_t n)
+    {
+        if (n > (std::numeric_limits<size_t>::max() - huge_page_size) / sizeof(T)) [[unlikely]]
+            throw std::bad_array_new_length();
+        size_t bytes = n * sizeof(T);
+        if (bytes < huge_page_size)
+            return static_cast<T *>(::operator new(bytes, std::align_val_t(alignment)));
+        size_t len = _round_up(bytes);
+#if defined(__linux__)
+        //? mmap 只保证 4KB 对齐: 多映射一个大页, 再把首尾多余的部分还给内核
+        void *raw = ::mmap(NULL, len + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) [[unlikely]]
+            throw std::bad_alloc();
+        char *base = static_cast<char *>(raw);
+        char *aligned = reinterpret_cast<char *>(_round_up(reinterpret_cast<size_t>(base)));
+        if (aligned != base)
+            ::munmap(base, aligned - base);
+        ::munmap(aligned + len, base + huge_page_size - aligned);
+        ::madvise(aligned, len, MADV_HUGEPAGE);
+        return reinterpret_cast<T *>(aligned);
+#else
+        return static_cast<T *>(::operator new(len, std::align_val_t(huge_page_size)));
+#endif
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        size_t bytes = n * sizeof(T);
+        if (bytes < huge_page_size)
+        {
+            ::operator delete(p, bytes, std::align_val_t(alignment));
+            return;
+        }
+#if defined(__linux__)
+        ::munmap(p, _round_up(bytes));
+#else
+        ::operator delete(p, _round_up(bytes), std::align_val_t(huge_page_size));
+#endif
+    }
+
+    template <class U>
+    bool operator==(HugePageAllocator<U> const &) const noexcept
+    {
+        return true;
+    }
+};
+
+//?                             块池 SlabPool  目的：为 List 等节点容器批量分配定长块, 并回收复用
+//?   每次向全局堆申请一整块 chunk, 从中按顺序切出定长的 block; 释放的 block 挂到空闲链表上
+//?   空闲链表非空时分配与释放都不经过全局堆, chunk 只在池析构时整体归还
+//?   块大小由第一次分配确定 (恰为该对象的大小), 之后放不下或对齐不满足的请求直接转给 operator new
+struct SlabPool
+{
+private:
+    struct FreeBlock
+    {
+        FreeBlock *m_next;
+    };
+
+    struct Chunk
+    {
+        Chunk *m_next;
+    };
+
+    static constexpr size_t _header_size =
+        (sizeof(Chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    FreeBlock *m_free;
+    Chunk *m_chunks;
+    char *m_cursor;
+    char *m_end;
+    size_t m_block_size;
+    size_t m_blocks_per_chunk;
+    size_t m_chunk_count;
+
+    void _new_chunk(size_t blocks)
+    { //* 新 chunk 的块按地址顺序依次切出, 连续分配的节点在内存中也相邻
+        size_t bytes = _header_size + m_block_size * blocks;
+        Chunk *chunk = static_cast<Chunk *>(::operator new(bytes));
+        chunk->m_next = m_chunks;
+        m_chunks = chunk;
+        m_cursor = reinterpret_cast<char *>(chunk) + _header_size;
+        m_end = reinterpret_cast<char *>(chunk) + bytes;
+        m_chunk_count++;
+    }
+
+    bool _fits(size_t bytes, size_t align) noexcept
+    { //? chunk 的起点按 max_align_t 对齐, 块大小是 align 的倍数时每个块都满足对齐
+        if (m_block_size == 0) [[unlikely]]
+        {
+            size_t size = bytes < sizeof(FreeBlock) ? sizeof(FreeBlock) : bytes;
+            size_t unit = align > alignof(FreeBlock) ? align : alignof(FreeBlock);
+            m_block_size = (size + unit - 1) & ~(unit - 1);
+        }
+        return bytes <= m_block_size && align <= alignof(std::max_align_t) && m_block_size % align == 0;
+    }
+
+    //? 超出块大小的罕见请求单独成函数且不内联: 快路径里只剩池内的块, 编译器不会把
+    //?   池内块与 operator delete 放进同一段代码 (否则 GCC 会误报 -Wfree-nonheap-object)
+    [[gnu::noinline]] static void *_oversize_allocate(size_t bytes, size_t align)
+    {
+        return ::operator new(bytes, std::align_val_t(align));
+    }
+
+    [[gnu::noinline]] static void _oversize_deallocate(void *p, size_t bytes, size_t align) noexcept
+    {
+        ::operator delete(p, bytes, std::align_val_t(align));
+    }
+
+public:
+    explicit SlabPool(size_t blocks_per_chunk = 256) noexcept
+        : m_free(NULL), m_chunks(NULL), m_cursor(NULL), m_end(NULL),
+          m_block_size(0), m_blocks_per_chunk(blocks_per_chunk != 0 ? blocks_per_chunk : 1), m_chunk_count(0)
+    {
+    }
+
+    SlabPool(SlabPool const &) = delete;
+    SlabPool &operator=(SlabPool const &) = delete;
+
+    ~SlabPool()
+    {
+        while (m_chunks != NULL)
+        {
+            Chunk *next = m_chunks->m_next;
+            ::operator delete(m_chunks);
+            m_chunks = next;
+        }
+    }
+
+    size_t block_size() const noexcept
+    {
+        return m_block_size;
+    }
+
+    size_t chunk_count() const noexcept
+    { //* 已向全局堆申请的 chunk 个数
+        return m_chunk_count;
+    }
+
+    void *allocate(size_t bytes, size_t align)
+    {
+        if (!_fits(bytes, align)) [[unlikely]]
+            return _oversize_allocate(bytes, align);
+        if (m_free != NULL)
+        {
+            FreeBlock *block = m_free;
+            m_free = block->m_next;
+            return block;
+        }
+        if (m_cursor == m_end)
+            _new_chunk(m_blocks_per_chunk);
+        void *p = m_cursor;
+        m_cursor += m_block_size;
+        return p;
+    }
+
+    void *allocate_contiguous(size_t bytes, size_t align, size_t n)
+    { //* 一次取出 n 个地址连续、间隔恰为 bytes 的块, 之后仍可逐块 deallocate; 做不到时返回 NULL
+        if (!_fits(bytes, align) || bytes != m_block_size || n == 0)
+            return NULL;
+        if (size_t(m_end - m_cursor) < n * m_block_size)
+        { //? 当前 chunk 剩余的块不够, 挂到空闲链表上留作以后单个分配
+            for (; m_cursor != m_end; m_cursor += m_block_size)
+                deallocate(m_cursor, bytes, align);
+            _new_chunk(n > m_blocks_per_chunk ? n : m_blocks_per_chunk);
+        }
+        void *p = m_cursor;
+        m_cursor += n * m_block_size;
+        return p;
+    }
+
+    void deallocate(void *p, size_t bytes, size_t align) noexcept
+    {
+        if (!_fits(bytes, align)) [[unlikely]]
+        {
+            _oversize_deallocate(p, bytes, align);
+            return;
+        }
+        FreeBlock *block = static_cast<FreeBlock *>(p);
+        block->m_next = m_free;
+        m_free = block;
+    }
+};
+
+//?                             池分配器 PoolAllocator  目的：让 List 的节点从 SlabPool 中分配
+//?   默认构造时自带一个池 (每个 List 独享); 拷贝分配器即共享同一个池, 可让多个 List 共用
+//?   拷贝构造容器时副本得到一个新的池 (select_on_container_copy_construction), 共享池需显式传入同一个 shared_ptr<SlabPool>
+//?   只有单个对象的分配走池, 数组分配仍走 operator new; 池本身不是线程安全的
+template <class T>
+struct PoolAllocator
+{
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    template <class U>
+    struct rebind
+    {
+        using other = PoolAllocator<U>;
+    };
+
+    std::shared_ptr<SlabPool> m_pool;
+
+    PoolAllocator() : m_pool(std::make_shared<SlabPool>()) {}
+
+    explicit PoolAllocator(std::shared_ptr<SlabPool> pool) noexcept : m_pool(std::move(pool)) {}
+
+    //? 只提供拷贝构造: 被移动的 List 仍需要一个可用的池
+    PoolAllocator(PoolAllocator const &that) noexcept : m_pool(that.m_pool) {}
+
+    template <class U>
+    PoolAllocator(PoolAllocator<U> const &that) noexcept : m_pool(that.m_pool) {}
+
+    PoolAllocator &operator=(PoolAllocator const &that) noexcept
+    {
+        m_pool = that.m_pool;
+        return *this;
+    }
+
+    PoolAllocator select_on_container_copy_construction() const
+    { //* 池不是线程安全的, 容器的副本可能交给别的线程, 不能悄悄共享
+        return PoolAllocator();
+    }
+
+    T *allocate(size_t n)
+    {
+        if (n == 1)
+            return static_cast<T *>(m_pool->allocate(sizeof(T), alignof(T)));
+        return std::allocator<T>().allocate(n);
+    }
+
+    T *allocate_bulk(size_t n)
+    { //* n 个地址连续、可逐个 deallocate(p, 1) 的对象, 池的块大小不等于 sizeof(T) 时返回 NULL
+        return static_cast<T *>(m_pool->allocate_contiguous(sizeof(T), alignof(T), n));
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        if (n == 1)
+            m_pool->deallocate(p, sizeof(T), alignof(T));
+        else
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(PoolAllocator<U> const &that) const noexcept
+    {
+        return m_pool == that.m_pool;
+    }
+};
@@ -0,0 +1,565 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <compare>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+#include "vector.hpp"
+
+//?                             下标链表 ArenaList  目的：节点存放在一个 Vector 中, 用 32 位下标代替指针链接
+//?   每个节点只多出 8 字节链接 (List 为 16 字节), 删除的节点串成空闲下标链供下次复用
+//?   链表内部没有任何指针, 整体可平凡重定位; T 可平凡复制时节点也可平凡复制, 复制链表只需复制节点数组
+//?   迭代器保存 (链表地址, 下标), Vector 扩容搬迁节点后迭代器依然有效
+
+template <class T>
+struct ArenaNode
+{
+    static constexpr uint32_t nil = UINT32_MAX;          //? 空链接, 同时作为 end() 的下标
+    static constexpr uint32_t free_tag = UINT32_MAX - 1; //? 空闲节点的 m_prev 取此值, 其 m_value 未构造
+
+    uint32_t m_next;
+    uint32_t m_prev;
+    union
+    {
+        T m_value;
+    };
+
+    template <class... Args>
+    ArenaNode(uint32_t next, uint32_t prev, std::in_place_t, Args &&...args)
+        : m_next(next), m_prev(prev)
+    {
+        std::__construct_at(&m_value, std::forward<Args>(args)...);
+    }
+
+    bool is_free() const noexcept
+    {
+        return m_prev == free_tag;
+    }
+
+    //? T 可平凡复制时节点的特殊成员全部平凡, Vector 按字节搬迁与复制; 否则按节点状态决定是否处理 m_value
+    ArenaNode(ArenaNode const &) requires std::is_trivially_copyable_v<T> = default;
+    ArenaNode(ArenaNode &&) requires std::is_trivially_copyable_v<T> = default;
+    ~ArenaNode() requires std::is_trivially_copyable_v<T> = default;
+
+    ArenaNode(ArenaNode const &that) : m_next(that.m_next), m_prev(that.m_prev)
+    {
+        if (!that.is_free())
+            std::__construct_at(&m_value, that.m_value);
+    }
+
+    ArenaNode(ArenaNode &&that) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_next(that.m_next), m_prev(that.m_prev)
+    {
+        if (!that.is_free())
+            std::__construct_at(&m_value, std::move(that.m_value));
+    }
+
+    ~ArenaNode()
+    {
+        if (!is_free())
+            std::destroy_at(&m_value);
+    }
+
+    ArenaNode &operator=(ArenaNode const &) = delete;
+};
+
+template <class T, class Alloc = std::allocator<T>>
+struct ArenaList
+{
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using reference = T &;
+    using const_reference = T const &;
+
+private:
+    using Node = ArenaNode<T>;
+    using AllocNode = std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+
+    static constexpr uint32_t nil = Node::nil;
+
+    Vector<Node, AllocNode> m_nodes;
+    uint32_t m_head;
+    uint32_t m_tail;
+    uint32_t m_free; //? 空闲下标链的链头, 经由空闲节点的 m_next 串起
+    size_t m_size;
+
+    void _init() noexcept
+    {
+        m_head = nil;
+        m_tail = nil;
+        m_free = nil;
+        m_size = 0;
+    }
+
+    void _link_before(uint32_t pos, uint32_t idx) noexcept
+    { //* 把已构造好的节点 idx 接到 pos 之前, pos 为 nil 表示接在末尾
+        uint32_t prev = pos == nil ? m_tail : m_nodes[pos].m_prev;
+        m_nodes[idx].m_prev = prev;
+        m_nodes[idx].m_next = pos;
+        if (prev == nil)
+            m_head = idx;
+        else
+            m_nodes[prev].m_next = idx;
+        if (pos == nil)
+            m_tail = idx;
+        else
+            m_nodes[pos].m_prev = idx;
+        m_size++;
+    }
+
+    template <class... Args>
+    uint32_t _new_node(Args &&...args)
+    { //* 优先复用空闲下标, 否则在节点数组末尾追加; 返回的节点尚未接入链表
+        if (m_free != nil)
+        {
+            uint32_t idx = m_free;
+            Node &node = m_nodes[idx];
+            uint32_t next_free = node.m_next;
+            std::__construct_at(&node.m_value, std::forward<Args>(args)...);
+            node.m_prev = nil;
+            m_free = next_free;
+            return idx;
+        }
+        if (m_nodes.size() >= Node::free_tag) [[unlikely]]
+            throw std::length_error("ArenaList: too many nodes for 32-bit links");
+        uint32_t idx = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back(nil, nil, std::in_place, std::forward<Args>(args)...);
+        return idx;
+    }
+
+    uint32_t _erase_node(uint32_t idx) noexcept
+    { //* 摘除节点 idx 并放入空闲链, 返回其后继下标
+        Node &node = m_nodes[idx];
+        uint32_t prev = node.m_prev;
+        uint32_t next = node.m_next;
+        if (prev == nil)
+            m_head = next;
+        else
+            m_nodes[prev].m_next = next;
+        if (next == nil)
+            m_tail = prev;
+        else
+            m_nodes[next].m_prev = prev;
+        std::destroy_at(&node.m_value);
+        node.m_prev = Node::free_tag;
+        node.m_next = m_free;
+        m_free = idx;
+        m_size--;
+        return next;
+    }
+
+public:
+    struct const_iterator;
+
+    struct iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        ArenaList *m_list;
+        uint32_t m_idx;
+
+        friend ArenaList;
+        friend const_iterator;
+
+        iterator(ArenaList *list, uint32_t idx) noexcept : m_list(list), m_idx(idx) {}
+
+    public:
+        iterator() = default;
+
+        iterator &operator++() noexcept
+        {
+            m_idx = m_list->m_nodes[m_idx].m_next;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        iterator &operator--() noexcept
+        {
+            m_idx = m_idx == nil ? m_list->m_tail : m_list->m_nodes[m_idx].m_prev;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T &operator*() const noexcept
+        {
+            return m_list->m_nodes[m_idx].m_value;
+        }
+
+        T *operator->() const noexcept
+        {
+            return &m_list->m_nodes[m_idx].m_value;
+        }
+
+        bool operator==(iterator const &that) const noexcept
+        {
+            return m_idx == that.m_idx;
+        }
+
+        bool operator!=(iterator const &that) const noexcept
+        {
+            return m_idx != that.m_idx;
+        }
+    };
+
+    struct const_iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T const *;
+        using reference = T const &;
+
+    private:
+        ArenaList const *m_list;
+        uint32_t m_idx;
+
+        friend ArenaList;
+
+        const_iterator(ArenaList const *list, uint32_t idx) noexcept : m_list(list), m_idx(idx) {}
+
+    public:
+        const_iterator() = default;
+
+        const_iterator(iterator that) noexcept : m_list(that.m_list), m_idx(that.m_idx) {}
+
+        const_iterator &operator++() noexcept
+        {
+            m_idx = m_list->m_nodes[m_idx].m_next;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        const_iterator &operator--() noexcept
+        {
+            m_idx = m_idx == nil ? m_list->m_tail : m_list->m_nodes[m_idx].m_prev;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T const &operator*() const noexcept
+        {
+            return m_list->m_nodes[m_idx].m_value;
+        }
+
+        T const *operator->() const noexcept
+        {
+            return &m_list->m_nodes[m_idx].m_value;
+        }
+
+        bool operator==(const_iterator const &that) const noexcept
+        {
+            return m_idx == that.m_idx;
+        }
+
+        bool operator!=(const_iterator const &that) const noexcept
+        {
+            return m_idx != that.m_idx;
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using reverse_const_iterator = std::reverse_iterator<const_iterator>;
+
+    ArenaList()
+    {
+        _init();
+    }
+
+    explicit ArenaList(Alloc const &alloc) : m_nodes(AllocNode(alloc))
+    {
+        _init();
+    }
+
+    ArenaList(size_t n, T const &val, Alloc const &alloc = Alloc()) : m_nodes(AllocNode(alloc))
+    {
+        _init();
+        m_nodes.reserve(n);
+        for (size_t i = 0; i != n; i++)
+            emplace_back(val);
+    }
+
+    template <std::input_iterator InputIt>
+    ArenaList(InputIt first, InputIt last, Alloc const &alloc = Alloc()) : m_nodes(AllocNode(alloc))
+    {
+        _init();
+        if constexpr (std::forward_iterator<InputIt>)
+            m_nodes.reserve(std::distance(first, last));
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    ArenaList(std::initializer_list<T> ilist, Alloc const &alloc = Alloc())
+        : ArenaList(ilist.begin(), ilist.end(), alloc) {}
+
+    //? 节点数组原样复制, 下标链接无需修正
+    ArenaList(ArenaList const &that) = default;
+
+    ArenaList(ArenaList &&that) noexcept
+        : m_nodes(std::move(that.m_nodes)), m_head(that.m_head), m_tail(that.m_tail),
+          m_free(that.m_free), m_size(that.m_size)
+    {
+        that._init();
+    }
+
+    ArenaList &operator=(ArenaList const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        m_nodes.clear();
+        m_nodes = that.m_nodes;
+        m_head = that.m_head;
+        m_tail = that.m_tail;
+        m_free = that.m_free;
+        m_size = that.m_size;
+        return *this;
+    }
+
+    ArenaList &operator=(ArenaList &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        m_nodes = std::move(that.m_nodes);
+        m_head = that.m_head;
+        m_tail = that.m_tail;
+        m_free = that.m_free;
+        m_size = that.m_size;
+        that._init();
+        return *this;
+    }
+
+    void swap(ArenaList &that) noexcept
+    {
+        m_nodes.swap(that.m_nodes);
+        std::swap(m_head, that.m_head);
+        std::swap(m_tail, that.m_tail);
+        std::swap(m_free, that.m_free);
+        std::swap(m_size, that.m_size);
+    }
+
+    void clear()
+    {
+        m_nodes.clear();
+        _init();
+    }
+
+    void reserve(size_t n)
+    { //* 预留节点数组容量, 之后 n 个以内的插入不会搬迁节点
+        m_nodes.reserve(n);
+    }
+
+    size_t capacity() const
+    {
+        return m_nodes.capacity();
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    T &front()
+    {
+        return m_nodes[m_head].m_value;
+    }
+
+    T const &front() const
+    {
+        return m_nodes[m_head].m_value;
+    }
+
+    T &back()
+    {
+        return m_nodes[m_tail].m_value;
+    }
+
+    T const &back() const
+    {
+        return m_nodes[m_tail].m_value;
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{this, m_head};
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{this, nil};
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{this, m_head};
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{this, nil};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    reverse_const_iterator crbegin() const noexcept
+    {
+        return std::make_reverse_iterator(cend());
+    }
+
+    reverse_const_iterator crend() const noexcept
+    {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args &&...args)
+    {
+        uint32_t idx = _new_node(std::forward<Args>(args)...);
+        _link_before(pos.m_idx, idx);
+        return iterator{this, idx};
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args)
+    {
+        return *emplace(cend(), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return *emplace(cbegin(), std::forward<Args>(args)...);
+    }
+
+    iterator insert(const_iterator pos, T const &val)
+    {
+        return emplace(pos, val);
+    }
+
+    iterator insert(const_iterator pos, T &&val)
+    {
+        return emplace(pos, std::move(val));
+    }
+
+    void push_back(T const &val)
+    {
+        emplace_back(val);
+    }
+
+    void push_back(T &&val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    void push_front(T const &val)
+    {
+        emplace_front(val);
+    }
+
+    void push_front(T &&val)
+    {
+        emplace_front(std::move(val));
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    {
+        return iterator{this, _erase_node(pos.m_idx)};
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        uint32_t idx = first.m_idx;
+        while (idx != last.m_idx)
+            idx = _erase_node(idx);
+        return iterator{this, idx};
+    }
+
+    void pop_front() noexcept
+    {
+        _erase_node(m_head);
+    }
+
+    void pop_back() noexcept
+    {
+        _erase_node(m_tail);
+    }
+
+    bool operator==(ArenaList const &that) const
+    {
+        if (m_size != that.m_size)
+            return false;
+        return std::equal(cbegin(), cend(), that.cbegin());
+    }
+
+    auto operator<=>(ArenaList const &that) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), that.cbegin(), that.cend());
+    }
+};
+
+//? ArenaList 内部只有下标, 节点数组可重定位时整体也可按字节搬迁
+template <class T, class Alloc>
+struct is_trivially_relocatable<ArenaList<T, Alloc>>
+    : is_trivially_relocatable<Vector<ArenaNode<T>, typename std::allocator_traits<Alloc>::template rebind_alloc<ArenaNode<T>>>>
+{
+};
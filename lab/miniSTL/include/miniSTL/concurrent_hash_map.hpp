@@ -0,0 +1,418 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <optional>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <miniSTL/hash.hpp>
+
+//?                             分段并发哈希表 ConcurrentHashMap  目的：用多个独立加锁的分段代替一把全局锁
+//?   键按哈希值的高位分到 Shards 个分段, 每个分段是一张线性探测的开放寻址表, 写操作只锁自己的分段, 扩容也只在分段内进行
+//?   键和值都可平凡复制时读操作不加锁: 分段带一个序号 (seqlock), 写者修改前后各加一, 读者复制出结果后检查序号未变, 否则重试
+//?     为保证无锁读者不会访问已释放的内存, 扩容后旧表不立即释放, 只在析构或 reclaim() 时释放 (总量不超过当前表的大小)
+//?   其他类型的读操作持分段的共享锁
+//?   接口按值返回 (find 返回 std::optional<V>), 不暴露指向内部的引用或迭代器
+
+template <class Key, class Value, class Hash = Hasher<Key>, class KeyEqual = std::equal_to<Key>,
+          size_t Shards = 64, class Alloc = std::allocator<std::pair<Key, Value>>>
+struct ConcurrentHashMap
+{
+    static_assert(Shards != 0 && (Shards & (Shards - 1)) == 0, "ConcurrentHashMap: Shards must be a power of 2");
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Alloc;
+
+    //? 是否使用无锁的 seqlock 读
+    static constexpr bool lock_free_reads = std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>;
+
+private:
+    using Slot = std::pair<Key, Value>;
+    using AllocSlot = std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using AllocByte = std::allocator_traits<Alloc>::template rebind_alloc<uint8_t>;
+
+    struct Table
+    {
+        size_t m_cap;     //? 2 的幂
+        uint8_t *m_used;  //? 每个槽是否已占用
+        Slot *m_slots;
+        Table *m_retired; //? 被本表取代的更早的旧表
+    };
+
+    struct alignas(64) Shard
+    { //* 各分段独占缓存行, 避免不同分段的锁和序号互相干扰
+        std::atomic<uint64_t> m_seq{0};
+        std::atomic<Table *> m_table{NULL};
+        std::atomic<size_t> m_size{0};
+        mutable std::shared_mutex m_mutex;
+    };
+
+    static constexpr unsigned shard_bits = std::countr_zero(Shards);
+    static constexpr size_t min_cap = 16;
+
+    Shard m_shards[Shards];
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_eq;
+    [[no_unique_address]] AllocSlot m_alloc;
+
+    size_t _hash(Key const &key) const
+    {
+        return _hash_mix<Hash>(m_hash(key));
+    }
+
+    static Shard &_shard(Shard *shards, size_t h) noexcept
+    { //* 高位选分段, 低位在分段内定位, 两者互不相关
+        if constexpr (shard_bits == 0)
+            return shards[0];
+        else
+            return shards[h >> (64 - shard_bits)];
+    }
+
+    Table *_new_table(size_t cap)
+    {
+        AllocByte alloc_byte(m_alloc);
+        Table *table = new Table{cap, NULL, NULL, NULL};
+        try
+        {
+            table->m_used = alloc_byte.allocate(cap);
+            std::memset(table->m_used, 0, cap);
+            table->m_slots = m_alloc.allocate(cap);
+        }
+        catch (...)
+        {
+            if (table->m_used != NULL)
+                alloc_byte.deallocate(table->m_used, cap);
+            delete table;
+            throw;
+        }
+        return table;
+    }
+
+    void _free_table(Table *table, bool destroy) noexcept
+    { //* destroy 为假时表中元素已被移走或可平凡析构
+        if (destroy && !std::is_trivially_destructible_v<Slot>)
+            for (size_t i = 0; i != table->m_cap; i++)
+                if (table->m_used[i])
+                    std::destroy_at(&table->m_slots[i]);
+        AllocByte(m_alloc).deallocate(table->m_used, table->m_cap);
+        m_alloc.deallocate(table->m_slots, table->m_cap);
+        delete table;
+    }
+
+    void _free_chain(Table *table, bool destroy) noexcept
+    { //* 释放 table 及其全部旧表, 旧表中的元素都已搬走
+        while (table != NULL)
+        {
+            Table *next = table->m_retired;
+            _free_table(table, destroy);
+            destroy = false;
+            table = next;
+        }
+    }
+
+    static size_t _probe(Table const *table, Key const &key, size_t h, KeyEqual const &eq) noexcept
+    { //* 线性探测, 找到返回槽号, 否则返回 m_cap; 最多探测 m_cap 次, 读到不一致的中间状态也不会死循环
+        size_t mask = table->m_cap - 1;
+        for (size_t i = h & mask, n = 0; n != table->m_cap; i = (i + 1) & mask, n++)
+        {
+            if (!table->m_used[i])
+                return table->m_cap;
+            if (eq(table->m_slots[i].first, key))
+                return i;
+        }
+        return table->m_cap;
+    }
+
+    //? 写者在修改前后各把序号加一, 奇数表示正在修改
+    static void _write_begin(Shard &shard) noexcept
+    {
+        if constexpr (lock_free_reads)
+        {
+            shard.m_seq.store(shard.m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+    }
+
+    static void _write_end(Shard &shard) noexcept
+    {
+        if constexpr (lock_free_reads)
+            shard.m_seq.store(shard.m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void _grow(Shard &shard, Table *table)
+    { //* 持有分段写锁时调用: 容量翻倍并重新插入, 旧表挂到新表的 m_retired 上
+        Table *bigger = _new_table(table->m_cap * 2);
+        size_t mask = bigger->m_cap - 1;
+        for (size_t i = 0; i != table->m_cap; i++)
+        {
+            if (!table->m_used[i])
+                continue;
+            size_t j = _hash(table->m_slots[i].first) & mask;
+            while (bigger->m_used[j])
+                j = (j + 1) & mask;
+            if constexpr (lock_free_reads) //? 旧表可能仍有读者, 只复制不析构
+                std::__construct_at(&bigger->m_slots[j], table->m_slots[i]);
+            else
+            {
+                std::__construct_at(&bigger->m_slots[j], std::move(table->m_slots[i]));
+                std::destroy_at(&table->m_slots[i]);
+            }
+            bigger->m_used[j] = 1;
+        }
+        if constexpr (lock_free_reads)
+        {
+            bigger->m_retired = table;
+            shard.m_table.store(bigger, std::memory_order_release);
+        }
+        else
+        {
+            bigger->m_retired = table->m_retired;
+            shard.m_table.store(bigger, std::memory_order_release);
+            _free_table(table, false);
+        }
+    }
+
+    void _erase_at(Table *table, size_t i) noexcept
+    { //* 删除槽 i 并把后面同一探测链上的元素前移, 不留墓碑
+        size_t mask = table->m_cap - 1;
+        std::destroy_at(&table->m_slots[i]);
+        table->m_used[i] = 0;
+        for (size_t j = (i + 1) & mask; table->m_used[j]; j = (j + 1) & mask)
+        {
+            size_t home = _hash(table->m_slots[j].first) & mask;
+            //? home 不在 (i, j] 之间时, j 处的元素可以移到空出的 i 处
+            if (((j - home) & mask) >= ((j - i) & mask))
+            {
+                std::__construct_at(&table->m_slots[i], std::move(table->m_slots[j]));
+                std::destroy_at(&table->m_slots[j]);
+                table->m_used[i] = 1;
+                table->m_used[j] = 0;
+                i = j;
+            }
+        }
+    }
+
+    template <class Func>
+    auto _read(Key const &key, Func func) const
+    { //* 在分段内查找 key, 对找到的槽调用 func(Slot const *) (未找到时为 NULL) 并返回其结果
+        size_t h = _hash(key);
+        Shard &shard = _shard(const_cast<Shard *>(m_shards), h);
+        if constexpr (lock_free_reads)
+        {
+            while (true)
+            {
+                uint64_t seq = shard.m_seq.load(std::memory_order_acquire);
+                if (seq & 1)
+                { //? 写者正在修改, 让出时间片以免线程数多于核数时空转
+                    std::this_thread::yield();
+                    continue;
+                }
+                Table const *table = shard.m_table.load(std::memory_order_acquire);
+                auto result = table == NULL ? func(NULL) : [&]
+                {
+                    size_t i = _probe(table, key, h, m_eq);
+                    return func(i == table->m_cap ? NULL : &table->m_slots[i]);
+                }();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (shard.m_seq.load(std::memory_order_relaxed) == seq)
+                    return result;
+            }
+        }
+        else
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.m_mutex);
+            Table const *table = shard.m_table.load(std::memory_order_relaxed);
+            if (table == NULL)
+                return func(NULL);
+            size_t i = _probe(table, key, h, m_eq);
+            return func(i == table->m_cap ? NULL : &table->m_slots[i]);
+        }
+    }
+
+public:
+    ConcurrentHashMap() = default;
+
+    explicit ConcurrentHashMap(size_t n, Hash const &hash = Hash(), KeyEqual const &eq = KeyEqual(),
+                               Alloc const &alloc = Alloc())
+        : m_hash(hash), m_eq(eq), m_alloc(alloc)
+    {
+        reserve(n);
+    }
+
+    ConcurrentHashMap(ConcurrentHashMap const &) = delete;
+    ConcurrentHashMap &operator=(ConcurrentHashMap const &) = delete;
+
+    ~ConcurrentHashMap()
+    {
+        for (Shard &shard : m_shards)
+            _free_chain(shard.m_table.load(std::memory_order_relaxed), true);
+    }
+
+    template <class V>
+    bool insert_or_assign(Key const &key, V &&val)
+    { //* 插入或覆盖, 返回是否为新插入
+        size_t h = _hash(key);
+        Shard &shard = _shard(m_shards, h);
+        std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+        Table *table = shard.m_table.load(std::memory_order_relaxed);
+        if (table == NULL)
+        {
+            table = _new_table(min_cap);
+            shard.m_table.store(table, std::memory_order_release);
+        }
+        size_t i = _probe(table, key, h, m_eq);
+        if (i != table->m_cap)
+        {
+            _write_begin(shard);
+            table->m_slots[i].second = std::forward<V>(val);
+            _write_end(shard);
+            return false;
+        }
+        size_t size = shard.m_size.load(std::memory_order_relaxed);
+        if ((size + 1) * 4 > table->m_cap * 3) //? 负载因子上限 3/4
+        {
+            _write_begin(shard);
+            _grow(shard, table);
+            _write_end(shard);
+            table = shard.m_table.load(std::memory_order_relaxed);
+        }
+        size_t mask = table->m_cap - 1;
+        i = h & mask;
+        while (table->m_used[i])
+            i = (i + 1) & mask;
+        _write_begin(shard);
+        std::__construct_at(&table->m_slots[i], key, std::forward<V>(val));
+        table->m_used[i] = 1;
+        _write_end(shard);
+        shard.m_size.store(size + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::optional<Value> find(Key const &key) const
+    {
+        return _read(key, [](Slot const *slot)
+                     { return slot != NULL ? std::optional<Value>(slot->second) : std::nullopt; });
+    }
+
+    bool contains(Key const &key) const
+    {
+        return _read(key, [](Slot const *slot)
+                     { return slot != NULL; });
+    }
+
+    bool erase(Key const &key)
+    {
+        size_t h = _hash(key);
+        Shard &shard = _shard(m_shards, h);
+        std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+        Table *table = shard.m_table.load(std::memory_order_relaxed);
+        if (table == NULL)
+            return false;
+        size_t i = _probe(table, key, h, m_eq);
+        if (i == table->m_cap)
+            return false;
+        _write_begin(shard);
+        _erase_at(table, i);
+        _write_end(shard);
+        shard.m_size.store(shard.m_size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    template <class Func>
+    void for_each(Func func) const
+    { //* 逐个分段持共享锁遍历, 同一分段内看到一致的快照, 不同分段之间不保证同一时刻
+        for (Shard const &shard : m_shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.m_mutex);
+            Table const *table = shard.m_table.load(std::memory_order_relaxed);
+            if (table == NULL)
+                continue;
+            for (size_t i = 0; i != table->m_cap; i++)
+                if (table->m_used[i])
+                    func(std::as_const(table->m_slots[i].first), std::as_const(table->m_slots[i].second));
+        }
+    }
+
+    size_t size() const noexcept
+    { //* 各分段个数之和, 并发修改时只是近似值
+        size_t n = 0;
+        for (Shard const &shard : m_shards)
+            n += shard.m_size.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(size_t n)
+    { //* 按平均分布为每个分段预留容量
+        size_t per_shard = (n + Shards - 1) / Shards;
+        size_t cap = std::bit_ceil(std::max(min_cap, (per_shard * 4 + 2) / 3));
+        for (Shard &shard : m_shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+            Table *table = shard.m_table.load(std::memory_order_relaxed);
+            if (table == NULL)
+                shard.m_table.store(_new_table(cap), std::memory_order_release);
+            else
+            {
+                while (table->m_cap < cap)
+                {
+                    _write_begin(shard);
+                    _grow(shard, table);
+                    _write_end(shard);
+                    table = shard.m_table.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    void clear()
+    { //* 清空全部元素, 保留各分段当前的表
+        for (Shard &shard : m_shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+            Table *table = shard.m_table.load(std::memory_order_relaxed);
+            if (table == NULL)
+                continue;
+            _write_begin(shard);
+            for (size_t i = 0; i != table->m_cap; i++)
+                if (table->m_used[i])
+                {
+                    std::destroy_at(&table->m_slots[i]);
+                    table->m_used[i] = 0;
+                }
+            _write_end(shard);
+            shard.m_size.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void reclaim()
+    { //* 释放扩容留下的旧表; 调用时不能有并发的读者
+        for (Shard &shard : m_shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.m_mutex);
+            Table *table = shard.m_table.load(std::memory_order_relaxed);
+            if (table != NULL)
+            {
+                _free_chain(table->m_retired, false);
+                table->m_retired = NULL;
+            }
+        }
+    }
+};
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+#include <miniSTL/vector.hpp>
+#include <miniSTL/hash.hpp>
+
+//?                             布谷鸟过滤器 CuckooFilter  目的：支持删除的近似成员查询
+//?   每个桶 4 个 16 位指纹, 恰好装进一个 uint64_t; 指纹 0 表示空位
+//?   键只保存指纹, 两个候选桶 i1 = h & mask, i2 = i1 ^ hash(指纹): 只凭桶号和指纹就能算出另一个桶, 踢出时不需要原键
+//?   查询检查两个桶, 每个桶用一次 64 位运算同时比较 4 个指纹 (SWAR 的 "含零的 16 位段" 判定)
+//?   两个桶都满时随机踢出一个指纹到它的另一个桶, 至多 max_kicks 次; 仍失败时最后一个指纹暂存在 victim 中, 之后的插入都返回 false
+//?   删除只能删除确实插入过的键, 否则可能删掉别的键的相同指纹; 装载率约 95% 以内时误判率约 8 / 65535
+
+template <class T, class Hash = Hasher<T>, class Alloc = std::allocator<T>>
+struct CuckooFilter
+{
+    using key_type = T;
+    using hasher = Hash;
+    using allocator_type = Alloc;
+
+    static constexpr size_t slots_per_bucket = 4;
+    static constexpr size_t max_kicks = 500;
+
+private:
+    using AllocBucket = std::allocator_traits<Alloc>::template rebind_alloc<uint64_t>;
+
+    static constexpr uint64_t lane_ones = 0x0001000100010001ull;
+    static constexpr uint64_t lane_highs = 0x8000800080008000ull;
+    static constexpr size_t ahead = 16; //? 批量查询的预取距离, 为 2 的幂
+
+    Vector<uint64_t, AllocBucket> m_buckets;
+    size_t m_mask;
+    size_t m_count;
+    size_t m_victim_bucket;
+    uint16_t m_victim_fp; //? 0 表示没有暂存的指纹
+    uint64_t m_rng;
+    [[no_unique_address]] Hash m_hash;
+
+    static uint16_t _fingerprint(uint64_t h) noexcept
+    { //* 取高 16 位, 与选桶用的低位无关
+        uint16_t fp = uint16_t(h >> 48);
+        return fp != 0 ? fp : 1;
+    }
+
+    size_t _alt_index(size_t i, uint16_t fp) const noexcept
+    {
+        return (i ^ size_t(Hasher<uint16_t>()(fp))) & m_mask;
+    }
+
+    static bool _has(uint64_t bucket, uint16_t fp) noexcept
+    { //* 与 fp 异或后, 某个 16 位段为零即找到
+        uint64_t x = bucket ^ (fp * lane_ones);
+        return ((x - lane_ones) & ~x & lane_highs) != 0;
+    }
+
+    bool _put(size_t i, uint16_t fp) noexcept
+    {
+        uint64_t &bucket = m_buckets[i];
+        for (size_t j = 0; j != slots_per_bucket; j++)
+            if (((bucket >> (16 * j)) & 0xFFFF) == 0)
+            {
+                bucket |= uint64_t(fp) << (16 * j);
+                return true;
+            }
+        return false;
+    }
+
+    bool _remove(size_t i, uint16_t fp) noexcept
+    {
+        uint64_t &bucket = m_buckets[i];
+        for (size_t j = 0; j != slots_per_bucket; j++)
+            if (((bucket >> (16 * j)) & 0xFFFF) == fp)
+            {
+                bucket &= ~(uint64_t(0xFFFF) << (16 * j));
+                return true;
+            }
+        return false;
+    }
+
+    uint64_t _random() noexcept
+    {
+        m_rng ^= m_rng << 13;
+        m_rng ^= m_rng >> 7;
+        m_rng ^= m_rng << 17;
+        return m_rng;
+    }
+
+    bool _insert_fp(size_t i1, uint16_t fp)
+    {
+        size_t i2 = _alt_index(i1, fp);
+        if (_put(i1, fp) || _put(i2, fp))
+            return true;
+        size_t i = _random() & 1 ? i1 : i2;
+        for (size_t kick = 0; kick != max_kicks; kick++)
+        { //? 随机换出桶中的一个指纹, 把它送往它的另一个桶
+            size_t j = _random() & (slots_per_bucket - 1);
+            uint64_t &bucket = m_buckets[i];
+            uint16_t out = uint16_t(bucket >> (16 * j));
+            bucket = (bucket & ~(uint64_t(0xFFFF) << (16 * j))) | (uint64_t(fp) << (16 * j));
+            fp = out;
+            i = _alt_index(i, fp);
+            if (_put(i, fp))
+                return true;
+        }
+        m_victim_bucket = i;
+        m_victim_fp = fp;
+        return true;
+    }
+
+    bool _victim_matches(size_t i1, size_t i2, uint16_t fp) const noexcept
+    {
+        return m_victim_fp == fp && (m_victim_bucket == i1 || m_victim_bucket == i2);
+    }
+
+    static void _prefetch(void const *p) noexcept
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(p);
+#else
+        (void)p;
+#endif
+    }
+
+public:
+    explicit CuckooFilter(size_t capacity, Hash const &hash = Hash(), Alloc const &alloc = Alloc())
+        : m_buckets(std::bit_ceil(std::max<size_t>((capacity * 20 / 19 + slots_per_bucket - 1) / slots_per_bucket, 1)),
+                    uint64_t(0), AllocBucket(alloc)),
+          m_mask(m_buckets.size() - 1), m_count(0), m_victim_bucket(0), m_victim_fp(0),
+          m_rng(0x9E3779B97F4A7C15ull), m_hash(hash)
+    { //* 桶数取 2 的幂, 按 95% 装载率容纳 capacity 个键
+    }
+
+    bool insert(T const &key)
+    { //* 过滤器已满 (有暂存的指纹) 时返回 false
+        if (m_victim_fp != 0)
+            return false;
+        uint64_t h = _hash_mix<Hash>(m_hash(key));
+        _insert_fp(size_t(h) & m_mask, _fingerprint(h));
+        m_count++;
+        return true;
+    }
+
+    bool contains(T const &key) const
+    {
+        uint64_t h = _hash_mix<Hash>(m_hash(key));
+        uint16_t fp = _fingerprint(h);
+        size_t i1 = size_t(h) & m_mask;
+        size_t i2 = _alt_index(i1, fp);
+        return _has(m_buckets[i1], fp) || _has(m_buckets[i2], fp) || _victim_matches(i1, i2, fp);
+    }
+
+    bool erase(T const &key)
+    { //* 删除一个匹配的指纹; 删除后尝试把暂存的指纹放回表中
+        uint64_t h = _hash_mix<Hash>(m_hash(key));
+        uint16_t fp = _fingerprint(h);
+        size_t i1 = size_t(h) & m_mask;
+        size_t i2 = _alt_index(i1, fp);
+        if (_victim_matches(i1, i2, fp))
+            m_victim_fp = 0;
+        else if (!_remove(i1, fp) && !_remove(i2, fp))
+            return false;
+        m_count--;
+        if (m_victim_fp != 0)
+        {
+            uint16_t victim = m_victim_fp;
+            m_victim_fp = 0;
+            _insert_fp(m_victim_bucket, victim);
+        }
+        return true;
+    }
+
+    template <class A>
+    size_t insert_bulk(Vector<T, A> const &keys)
+    { //* 返回成功插入的个数, 过滤器满后停止
+        size_t done = 0;
+        for (T const &key : keys)
+        {
+            if (!insert(key))
+                break;
+            done++;
+        }
+        return done;
+    }
+
+    template <class A, class B>
+    size_t contains_bulk(Vector<T, A> const &keys, Vector<uint8_t, B> &out) const
+    { //* out[i] 为 keys[i] 的查询结果 (0/1), 返回可能存在的个数; 提前 ahead 个键预取两个候选桶
+        out.resize_for_overwrite(keys.size());
+        size_t first[ahead], second[ahead];
+        uint16_t fps[ahead];
+        size_t n = keys.size();
+        size_t found = 0;
+        for (size_t i = 0; i != n + ahead; i++)
+        {
+            size_t k = i % ahead;
+            if (i >= ahead)
+            {
+                bool hit = _has(m_buckets[first[k]], fps[k]) || _has(m_buckets[second[k]], fps[k]) ||
+                           _victim_matches(first[k], second[k], fps[k]);
+                out[i - ahead] = hit;
+                found += hit;
+            }
+            if (i < n)
+            {
+                uint64_t h = _hash_mix<Hash>(m_hash(keys[i]));
+                fps[k] = _fingerprint(h);
+                first[k] = size_t(h) & m_mask;
+                second[k] = _alt_index(first[k], fps[k]);
+                _prefetch(&m_buckets[first[k]]);
+                _prefetch(&m_buckets[second[k]]);
+            }
+        }
+        return found;
+    }
+
+    void clear() noexcept
+    {
+        for (uint64_t &bucket : m_buckets)
+            bucket = 0;
+        m_count = 0;
+        m_victim_fp = 0;
+    }
+
+    size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    size_t capacity() const noexcept
+    {
+        return m_buckets.size() * slots_per_bucket;
+    }
+
+    double load_factor() const noexcept
+    {
+        return double(m_count) / capacity();
+    }
+
+    size_t memory_bytes() const noexcept
+    {
+        return m_buckets.size() * sizeof(uint64_t);
+    }
+
+    void swap(CuckooFilter &that) noexcept
+    {
+        m_buckets.swap(that.m_buckets);
+        std::swap(m_mask, that.m_mask);
+        std::swap(m_count, that.m_count);
+        std::swap(m_victim_bucket, that.m_victim_bucket);
+        std::swap(m_victim_fp, that.m_victim_fp);
+        std::swap(m_rng, that.m_rng);
+        std::swap(m_hash, that.m_hash);
+    }
+};
@@ -0,0 +1,607 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <compare>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+
+//?                             单向链表 ForwardList  目的：每个节点只有一个 m_next, 链接开销比 List 少一半
+//?   只能向前遍历, 所有修改都针对给定位置之后的节点 (insert_after / erase_after / splice_after)
+//?   不维护元素个数, 以保证 splice_after 区间为 O(1); 需要个数时用 std::distance(begin(), end())
+
+template <class T>
+struct ForwardBaseNode
+{
+    ForwardBaseNode *m_next;
+
+    inline T &value();
+    inline T const &value() const;
+};
+
+template <class T>
+struct ForwardValueNode : ForwardBaseNode<T>
+{
+    union
+    {
+        T m_value;
+    };
+};
+
+template <class T>
+inline T &ForwardBaseNode<T>::value()
+{
+    return static_cast<ForwardValueNode<T> &>(*this).m_value;
+}
+
+template <class T>
+inline T const &ForwardBaseNode<T>::value() const
+{
+    return static_cast<ForwardValueNode<T> const &>(*this).m_value;
+}
+
+template <class T, class Alloc = std::allocator<T>>
+struct ForwardList
+{
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using reference = T &;
+    using const_reference = T const &;
+
+private:
+    using ForwardNode = ForwardBaseNode<T>;
+    using AllocNode = std::allocator_traits<Alloc>::template rebind_alloc<ForwardValueNode<T>>;
+
+    ForwardNode m_head; //? 首元素之前的哨兵, 链尾以 NULL 结束
+    [[no_unique_address]] AllocNode m_alloc;
+
+    template <class... Args>
+    ForwardNode *_new_node(Args &&...args)
+    {
+        ForwardValueNode<T> *node = m_alloc.allocate(1);
+        try
+        {
+            std::__construct_at(&node->m_value, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_alloc.deallocate(node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void _delete_node(ForwardNode *node) noexcept
+    {
+        std::destroy_at(&node->value());
+        m_alloc.deallocate(static_cast<ForwardValueNode<T> *>(node), 1);
+    }
+
+    static ForwardNode *_before_last(ForwardNode *prev, ForwardNode *last) noexcept
+    { //* 从 prev 向后找到 m_next 为 last 的节点
+        while (prev->m_next != last)
+            prev = prev->m_next;
+        return prev;
+    }
+
+    template <class Compare>
+    static ForwardNode *_merge_chain(ForwardNode *a, ForwardNode *b, Compare &comp)
+    { //* 归并两条以 NULL 结尾的有序链, 相等时 a 在前以保持稳定
+        ForwardNode head;
+        ForwardNode *tail = &head;
+        while (a != NULL && b != NULL)
+        {
+            if (comp(std::as_const(b->value()), std::as_const(a->value())))
+            {
+                tail->m_next = b;
+                b = b->m_next;
+            }
+            else
+            {
+                tail->m_next = a;
+                a = a->m_next;
+            }
+            tail = tail->m_next;
+        }
+        tail->m_next = a != NULL ? a : b;
+        return head.m_next;
+    }
+
+public:
+    struct const_iterator;
+
+    struct iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        ForwardNode *m_curr;
+
+        friend ForwardList;
+        friend const_iterator;
+
+        explicit iterator(ForwardNode *curr) noexcept : m_curr(curr) {}
+
+    public:
+        iterator() = default;
+
+        iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        T &operator*() const noexcept
+        {
+            return m_curr->value();
+        }
+
+        T *operator->() const noexcept
+        {
+            return &m_curr->value();
+        }
+
+        bool operator==(iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    struct const_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T const *;
+        using reference = T const &;
+
+    private:
+        ForwardNode const *m_curr;
+
+        friend ForwardList;
+
+        explicit const_iterator(ForwardNode const *curr) noexcept : m_curr(curr) {}
+
+    public:
+        const_iterator() = default;
+
+        const_iterator(iterator that) noexcept : m_curr(that.m_curr) {}
+
+        const_iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        T const &operator*() const noexcept
+        {
+            return m_curr->value();
+        }
+
+        T const *operator->() const noexcept
+        {
+            return &m_curr->value();
+        }
+
+        bool operator==(const_iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(const_iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    ForwardList() noexcept
+    {
+        m_head.m_next = NULL;
+    }
+
+    explicit ForwardList(Alloc const &alloc) noexcept : m_alloc(alloc)
+    {
+        m_head.m_next = NULL;
+    }
+
+    ForwardList(size_t n, T const &val, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        m_head.m_next = NULL;
+        insert_after(before_begin(), n, val);
+    }
+
+    template <std::input_iterator InputIt>
+    ForwardList(InputIt first, InputIt last, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        m_head.m_next = NULL;
+        insert_after(before_begin(), first, last);
+    }
+
+    ForwardList(std::initializer_list<T> ilist, Alloc const &alloc = Alloc())
+        : ForwardList(ilist.begin(), ilist.end(), alloc) {}
+
+    ForwardList(ForwardList const &that)
+        : m_alloc(std::allocator_traits<AllocNode>::select_on_container_copy_construction(that.m_alloc))
+    {
+        m_head.m_next = NULL;
+        insert_after(before_begin(), that.cbegin(), that.cend());
+    }
+
+    //? 哨兵只有一个 m_next, 不被任何节点指向, 移动时直接接管整条链
+    ForwardList(ForwardList &&that) noexcept : m_alloc(std::move(that.m_alloc))
+    {
+        m_head.m_next = that.m_head.m_next;
+        that.m_head.m_next = NULL;
+    }
+
+    ForwardList &operator=(ForwardList const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        insert_after(before_begin(), that.cbegin(), that.cend());
+        return *this;
+    }
+
+    ForwardList &operator=(ForwardList &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        m_alloc = std::move(that.m_alloc);
+        m_head.m_next = that.m_head.m_next;
+        that.m_head.m_next = NULL;
+        return *this;
+    }
+
+    ~ForwardList() noexcept
+    {
+        clear();
+    }
+
+    void swap(ForwardList &that) noexcept
+    {
+        std::swap(m_head.m_next, that.m_head.m_next);
+        std::swap(m_alloc, that.m_alloc);
+    }
+
+    void clear() noexcept
+    {
+        ForwardNode *curr = m_head.m_next;
+        while (curr != NULL)
+        {
+            ForwardNode *next = curr->m_next;
+            _delete_node(curr);
+            curr = next;
+        }
+        m_head.m_next = NULL;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_head.m_next == NULL;
+    }
+
+    T &front() noexcept
+    {
+        return m_head.m_next->value();
+    }
+
+    T const &front() const noexcept
+    {
+        return m_head.m_next->value();
+    }
+
+    iterator before_begin() noexcept
+    {
+        return iterator{&m_head};
+    }
+
+    const_iterator cbefore_begin() const noexcept
+    {
+        return const_iterator{&m_head};
+    }
+
+    const_iterator before_begin() const noexcept
+    {
+        return cbefore_begin();
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{m_head.m_next};
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{NULL};
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{m_head.m_next};
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{NULL};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    template <class... Args>
+    iterator emplace_after(const_iterator pos, Args &&...args)
+    {
+        ForwardNode *prev = const_cast<ForwardNode *>(pos.m_curr);
+        ForwardNode *node = _new_node(std::forward<Args>(args)...);
+        node->m_next = prev->m_next;
+        prev->m_next = node;
+        return iterator{node};
+    }
+
+    iterator insert_after(const_iterator pos, T const &val)
+    {
+        return emplace_after(pos, val);
+    }
+
+    iterator insert_after(const_iterator pos, T &&val)
+    {
+        return emplace_after(pos, std::move(val));
+    }
+
+    iterator insert_after(const_iterator pos, size_t n, T const &val)
+    { //* 返回最后插入的元素, n 为 0 时返回 pos
+        iterator it{const_cast<ForwardNode *>(pos.m_curr)};
+        for (size_t i = 0; i != n; i++)
+            it = emplace_after(it, val);
+        return it;
+    }
+
+    template <std::input_iterator InputIt>
+    iterator insert_after(const_iterator pos, InputIt first, InputIt last)
+    {
+        iterator it{const_cast<ForwardNode *>(pos.m_curr)};
+        for (; first != last; ++first)
+            it = emplace_after(it, *first);
+        return it;
+    }
+
+    iterator insert_after(const_iterator pos, std::initializer_list<T> ilist)
+    {
+        return insert_after(pos, ilist.begin(), ilist.end());
+    }
+
+    template <class... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return *emplace_after(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    void push_front(T const &val)
+    {
+        emplace_front(val);
+    }
+
+    void push_front(T &&val)
+    {
+        emplace_front(std::move(val));
+    }
+
+    void pop_front() noexcept
+    {
+        erase_after(cbefore_begin());
+    }
+
+    iterator erase_after(const_iterator pos) noexcept
+    {
+        ForwardNode *prev = const_cast<ForwardNode *>(pos.m_curr);
+        ForwardNode *node = prev->m_next;
+        prev->m_next = node->m_next;
+        _delete_node(node);
+        return iterator{prev->m_next};
+    }
+
+    iterator erase_after(const_iterator pos, const_iterator last) noexcept
+    { //* 删除开区间 (pos, last) 内的节点
+        ForwardNode *prev = const_cast<ForwardNode *>(pos.m_curr);
+        ForwardNode *stop = const_cast<ForwardNode *>(last.m_curr);
+        ForwardNode *curr = prev->m_next;
+        while (curr != stop)
+        {
+            ForwardNode *next = curr->m_next;
+            _delete_node(curr);
+            curr = next;
+        }
+        prev->m_next = stop;
+        return iterator{stop};
+    }
+
+    //? splice_after 系列: 把 that 中的节点接到 pos 之后, 不分配内存、不移动元素, 迭代器保持有效
+    //?   要求两个 ForwardList 的分配器相等
+    void splice_after(const_iterator pos, ForwardList &that, const_iterator first, const_iterator last) noexcept
+    { //* 转移开区间 (first, last), 需要向后找到区间的最后一个节点
+        ForwardNode *before = const_cast<ForwardNode *>(first.m_curr);
+        ForwardNode *stop = const_cast<ForwardNode *>(last.m_curr);
+        if (before == pos.m_curr || before->m_next == stop)
+            return;
+        ForwardNode *prev = const_cast<ForwardNode *>(pos.m_curr);
+        ForwardNode *tail = _before_last(before, stop);
+        tail->m_next = prev->m_next;
+        prev->m_next = before->m_next;
+        before->m_next = stop;
+        (void)that;
+    }
+
+    void splice_after(const_iterator pos, ForwardList &&that, const_iterator first, const_iterator last) noexcept
+    {
+        splice_after(pos, that, first, last);
+    }
+
+    void splice_after(const_iterator pos, ForwardList &that) noexcept
+    {
+        splice_after(pos, that, that.cbefore_begin(), that.cend());
+    }
+
+    void splice_after(const_iterator pos, ForwardList &&that) noexcept
+    {
+        splice_after(pos, that);
+    }
+
+    void splice_after(const_iterator pos, ForwardList &that, const_iterator it) noexcept
+    { //* 转移 it 之后的那一个节点, O(1)
+        ForwardNode *before = const_cast<ForwardNode *>(it.m_curr);
+        ForwardNode *prev = const_cast<ForwardNode *>(pos.m_curr);
+        ForwardNode *node = before->m_next;
+        if (prev == before || prev == node)
+            return;
+        before->m_next = node->m_next;
+        node->m_next = prev->m_next;
+        prev->m_next = node;
+        (void)that;
+    }
+
+    void splice_after(const_iterator pos, ForwardList &&that, const_iterator it) noexcept
+    {
+        splice_after(pos, that, it);
+    }
+
+    template <class Compare = std::less<>>
+    void merge(ForwardList &that, Compare comp = Compare())
+    { //* 两表均已有序, 相等元素本表在前
+        if (&that == this)
+            return;
+        m_head.m_next = _merge_chain(m_head.m_next, that.m_head.m_next, comp);
+        that.m_head.m_next = NULL;
+    }
+
+    template <class Compare = std::less<>>
+    void merge(ForwardList &&that, Compare comp = Compare())
+    {
+        merge(that, comp);
+    }
+
+    template <class Compare = std::less<>>
+    void sort(Compare comp = Compare())
+    { //* 与 List::sort 相同的自底向上稳定归并, 只重新链接 m_next, 不分配内存
+        //? bins[i] 保存长度为 2^i 的有序段, 像二进制计数器一样逐级进位归并
+        ForwardNode *bins[64] = {};
+        ForwardNode *curr = m_head.m_next;
+        while (curr != NULL)
+        {
+            ForwardNode *next = curr->m_next;
+            curr->m_next = NULL;
+            size_t i = 0;
+            for (; bins[i] != NULL; i++)
+            {
+                curr = _merge_chain(bins[i], curr, comp);
+                bins[i] = NULL;
+            }
+            bins[i] = curr;
+            curr = next;
+        }
+        ForwardNode *result = NULL;
+        for (size_t i = 0; i != 64; i++)
+            if (bins[i] != NULL)
+                result = result != NULL ? _merge_chain(bins[i], result, comp) : bins[i];
+        m_head.m_next = result;
+    }
+
+    void reverse() noexcept
+    {
+        ForwardNode *prev = NULL;
+        ForwardNode *curr = m_head.m_next;
+        while (curr != NULL)
+        {
+            ForwardNode *next = curr->m_next;
+            curr->m_next = prev;
+            prev = curr;
+            curr = next;
+        }
+        m_head.m_next = prev;
+    }
+
+    template <class Pred>
+    size_t remove_if(Pred pred)
+    { //* 单趟遍历, 返回删除的个数
+        size_t count = 0;
+        ForwardNode *prev = &m_head;
+        while (prev->m_next != NULL)
+        {
+            if (pred(std::as_const(prev->m_next->value())))
+            {
+                erase_after(const_iterator{prev});
+                count++;
+            }
+            else
+                prev = prev->m_next;
+        }
+        return count;
+    }
+
+    size_t remove(T const &val)
+    {
+        //? val 可能引用某个节点里的值, 先复制一份再比较
+        T tmp(val);
+        return remove_if([&](T const &x) { return x == tmp; });
+    }
+
+    bool operator==(ForwardList const &that) const
+    {
+        return std::equal(cbegin(), cend(), that.cbegin(), that.cend());
+    }
+
+    auto operator<=>(ForwardList const &that) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), that.cbegin(), that.cend());
+    }
+};
+
+template <class T, class Alloc, class Pred>
+size_t erase_if(ForwardList<T, Alloc> &lst, Pred pred)
+{
+    return lst.remove_if(pred);
+}
+
+template <class T, class Alloc>
+size_t erase(ForwardList<T, Alloc> &lst, T const &val)
+{
+    return lst.remove(val);
+}
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//?                             哈希函数库 Hasher<T>  目的：替代 std::hash 作为各哈希容器的默认哈希
+//?   libstdc++ 的 std::hash<int> 是恒等映射, 开放寻址表取低位定位时大量聚集; std::hash<string> 处理长键较慢
+//?   整数、枚举、指针、浮点: 与常数异或后做一次 64x64->128 位乘法, 高低两半异或 (wyhash 的 mum 混合)
+//?   字节串 hash_bytes:
+//?     不超过 16 字节: 读两个 (可重叠的) 字, 一次 mum 混合
+//?     17 ~ 128 字节: 每 16 字节一次 mum 混合, 尾部与前面重叠读取最后 16 字节
+//?     超过 128 字节: 仿 xxh3, 8 条 64 位累加通道每次吃进 64 字节 (SSE2 下两条通道一个寄存器), 每 1KB 打散一次, 最后两两 mum 合并
+//?   全部函数都是 constexpr, 编译期逐字节拼接, 运行期在小端机器上直接读取, 两者结果相同 (StaticMap 依赖这一点)
+//?   组合: pair / tuple 逐个元素合并; 自定义结构体提供返回 std::tie(...) 的成员函数 tie() 即可直接使用
+//?   其他类型退回 std::hash 再混合一次, 已有的 std::hash 特化仍然有效
+
+namespace _hash_detail
+{
+    inline constexpr uint64_t secret[4] = {0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull,
+                                           0x8EBC6AF09C88C6E3ull, 0x589965CC75374CC3ull};
+
+    //? 累加通道使用的密钥: 块内第 k 个条带用 [k, k + 8), 打散用 [16, 24), 尾部条带用 [24, 32)
+    inline constexpr uint64_t lane_secret[32] = {
+        0xBE4BA423396CFEB8ull, 0x1CAD21F72C81017Cull, 0xDB979083E96DD4DEull, 0x1F67B3B7A4A44072ull,
+        0x78E5C0CC4EE679CBull, 0x2172FFCC7DD05A82ull, 0x8E2443F7744608B8ull, 0x4C263A81E69035E0ull,
+        0xCB00C391BB52283Cull, 0xA32E531B8B65D088ull, 0x4EF90DA297486471ull, 0xD8ACDEA946EF1938ull,
+        0x3F349CE33F76FAA8ull, 0x1D4F0BC7C7BBDCF9ull, 0x3159B4CD4BE0518Aull, 0x647378D9C97E9FC8ull,
+        0xC3EBD33483ACC5EAull, 0xEB6313FAFFA081C5ull, 0x49DAF0B751DD0D17ull, 0x9E68D429265516D3ull,
+        0xFCA1477D58BE162Bull, 0xCE31D07AD1B8F88Full, 0x280416958F3ACB45ull, 0x7E404BBBCAFBD7AFull,
+        0x2E84496E7857DD86ull, 0x940EEE3CBA6F875Cull, 0x33406BC44DC2A627ull, 0xB938451EE325FAA6ull,
+        0xC1D8FAC168FB90D7ull, 0xC2354E2BB7740A63ull, 0x887E840043E58844ull, 0xA2DA95A83EC33DD6ull,
+    };
+
+    constexpr void mul128(uint64_t &a, uint64_t &b) noexcept
+    { //* 64x64 -> 128 位乘法, a 得到低 64 位, b 得到高 64 位
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 r = (unsigned __int128)a * b;
+        a = uint64_t(r);
+        b = uint64_t(r >> 64);
+#else
+        uint64_t ha = a >> 32, hb = b >> 32, la = uint32_t(a), lb = uint32_t(b);
+        uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        uint64_t t = rl + (rm0 << 32), c = t < rl;
+        uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        a = lo;
+        b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+    }
+
+    constexpr uint64_t mum(uint64_t a, uint64_t b) noexcept
+    { //* 128 位乘积的高低两半异或
+        mul128(a, b);
+        return a ^ b;
+    }
+
+    template <size_t Bytes>
+    constexpr uint64_t load(char const *p) noexcept
+    { //* 按小端拼接 Bytes (4 或 8) 个字节; 运行期在小端机器上直接读取
+        if (std::is_constant_evaluated() || std::endian::native != std::endian::little)
+        {
+            uint64_t w = 0;
+            for (size_t j = 0; j != Bytes; j++)
+                w |= uint64_t(uint8_t(p[j])) << (8 * j);
+            return w;
+        }
+        std::conditional_t<Bytes == 8, uint64_t, uint32_t> w;
+        std::memcpy(&w, p, Bytes);
+        return w;
+    }
+
+    constexpr uint64_t load8(char const *p) noexcept
+    {
+        return load<8>(p);
+    }
+
+    constexpr uint64_t load4(char const *p) noexcept
+    {
+        return load<4>(p);
+    }
+
+    constexpr uint64_t load_small(char const *p, size_t n) noexcept
+    { //* 1 ~ 3 字节: 首、中、尾三个字节覆盖全部输入
+        return (uint64_t(uint8_t(p[0])) << 16) | (uint64_t(uint8_t(p[n >> 1])) << 8) | uint8_t(p[n - 1]);
+    }
+
+    constexpr void accumulate_scalar(uint64_t *acc, char const *p, uint64_t const *key) noexcept
+    { //* 一个 64 字节条带: acc[i ^ 1] += 数据, acc[i] += 低 32 位 * 高 32 位 (数据与密钥异或后)
+        for (size_t i = 0; i != 8; i++)
+        {
+            uint64_t data = load8(p + 8 * i);
+            uint64_t dk = data ^ key[i];
+            acc[i ^ 1] += data;
+            acc[i] += (dk & 0xFFFFFFFFull) * (dk >> 32);
+        }
+    }
+
+    constexpr void scramble(uint64_t *acc, uint64_t const *key) noexcept
+    { //* 累加若干条带后打散, 让高位也扩散到低 32 位, 下一轮乘法才用得到
+        for (size_t i = 0; i != 8; i++)
+        {
+            uint64_t a = acc[i];
+            a ^= a >> 47;
+            a ^= key[i];
+            acc[i] = a * 0x9E3779B1ull;
+        }
+    }
+
+    constexpr void accumulate_all_scalar(uint64_t *acc, char const *p, size_t len) noexcept
+    {
+        constexpr size_t stripes_per_block = 16;
+        size_t stripe = 0;
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64)
+        { //? 同一块内每个条带的密钥错开一个字, 内容相同的条带互不抵消
+            accumulate_scalar(acc, p + i, lane_secret + stripe);
+            if (++stripe == stripes_per_block)
+            {
+                scramble(acc, lane_secret + 16);
+                stripe = 0;
+            }
+        }
+        if (i != len) //? 尾部不足 64 字节: 与前面重叠读取最后一个完整条带
+            accumulate_scalar(acc, p + len - 64, lane_secret + 24);
+    }
+
+#if defined(__SSE2__)
+    inline void accumulate_all_sse2(uint64_t *acc, char const *p, size_t len) noexcept
+    { //* 与 accumulate_all_scalar 逐位相同: 8 条通道常驻 4 个寄存器, _mm_mul_epu32 即低 32 位相乘
+        __m128i a[4];
+        for (size_t j = 0; j != 4; j++)
+            a[j] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(acc + 2 * j));
+        auto stripe_at = [&](char const *q, uint64_t const *key)
+        {
+            for (size_t j = 0; j != 4; j++)
+            {
+                __m128i data = _mm_loadu_si128(reinterpret_cast<__m128i const *>(q + 16 * j));
+                __m128i dk = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<__m128i const *>(key + 2 * j)));
+                __m128i product = _mm_mul_epu32(dk, _mm_srli_epi64(dk, 32));
+                __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                a[j] = _mm_add_epi64(a[j], _mm_add_epi64(product, swapped));
+            }
+        };
+        __m128i prime = _mm_set1_epi32(int(0x9E3779B1u));
+        size_t i = 0;
+        for (size_t stripe = 0; i + 64 <= len; i += 64)
+        {
+            stripe_at(p + i, lane_secret + stripe);
+            if (++stripe == 16)
+            { //? 64 位乘以 32 位常数: 低半乘积 + (高半乘积 << 32)
+                for (size_t j = 0; j != 4; j++)
+                {
+                    __m128i x = _mm_xor_si128(a[j], _mm_srli_epi64(a[j], 47));
+                    x = _mm_xor_si128(x, _mm_loadu_si128(reinterpret_cast<__m128i const *>(lane_secret + 16 + 2 * j)));
+                    __m128i lo = _mm_mul_epu32(x, prime);
+                    __m128i hi = _mm_mul_epu32(_mm_srli_epi64(x, 32), prime);
+                    a[j] = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+                }
+                stripe = 0;
+            }
+        }
+        if (i != len)
+            stripe_at(p + len - 64, lane_secret + 24);
+        for (size_t j = 0; j != 4; j++)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(acc + 2 * j), a[j]);
+    }
+#endif
+
+    constexpr uint64_t hash_long(char const *p, size_t len, uint64_t seed) noexcept
+    {
+        uint64_t acc[8] = {seed ^ secret[0], seed ^ secret[1], seed ^ secret[2], seed ^ secret[3],
+                           secret[0], secret[1], secret[2], secret[3]};
+#if defined(__SSE2__)
+        if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+            accumulate_all_sse2(acc, p, len);
+        else
+#endif
+            accumulate_all_scalar(acc, p, len);
+        uint64_t h = len * secret[1];
+        for (size_t k = 0; k != 8; k += 2)
+            h += mum(acc[k] ^ lane_secret[k + 8], acc[k + 1] ^ lane_secret[k + 9]);
+        return mum(h ^ secret[0], h >> 29 ^ secret[2]);
+    }
+
+    constexpr uint64_t hash_bytes(char const *p, size_t len, uint64_t seed) noexcept
+    {
+        if (len > 128)
+            return hash_long(p, len, seed);
+        seed ^= mum(seed ^ secret[0], secret[1]);
+        uint64_t a = 0, b = 0;
+        if (len <= 16)
+        {
+            if (len >= 4)
+            { //? 4 ~ 16 字节: 首尾各读两个 4 字节, 中间可能重叠
+                size_t mid = (len >> 3) << 2;
+                a = (load4(p) << 32) | load4(p + mid);
+                b = (load4(p + len - 4) << 32) | load4(p + len - 4 - mid);
+            }
+            else if (len > 0)
+                a = load_small(p, len);
+        }
+        else
+        {
+            size_t i = len;
+            char const *q = p;
+            if (i > 48)
+            { //? 三条独立的链并行, 减少乘法的依赖等待
+                uint64_t s1 = seed, s2 = seed;
+                do
+                {
+                    seed = mum(load8(q) ^ secret[1], load8(q + 8) ^ seed);
+                    s1 = mum(load8(q + 16) ^ secret[2], load8(q + 24) ^ s1);
+                    s2 = mum(load8(q + 32) ^ secret[3], load8(q + 40) ^ s2);
+                    q += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= s1 ^ s2;
+            }
+            while (i > 16)
+            {
+                seed = mum(load8(q) ^ secret[1], load8(q + 8) ^ seed);
+                q += 16;
+                i -= 16;
+            }
+            a = load8(p + len - 16);
+            b = load8(p + len - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        mul128(a, b);
+        return mum(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+
+    constexpr uint64_t hash_int(uint64_t x) noexcept
+    {
+        return mum(x ^ secret[0], secret[1]);
+    }
+} // namespace _hash_detail
+
+inline uint64_t hash_bytes(void const *data, size_t len, uint64_t seed = 0) noexcept
+{ //* 编译期请使用 string_view 版本
+    return _hash_detail::hash_bytes(static_cast<char const *>(data), len, seed);
+}
+
+constexpr uint64_t hash_bytes(std::string_view s, uint64_t seed = 0) noexcept
+{
+    return _hash_detail::hash_bytes(s.data(), s.size(), seed);
+}
+
+constexpr size_t hash_combine(size_t seed, size_t h) noexcept
+{ //* 把 h 合并进 seed, 顺序敏感: combine(combine(s, a), b) 与 combine(combine(s, b), a) 不同
+    return _hash_detail::mum(seed ^ _hash_detail::secret[2], h ^ _hash_detail::secret[3]);
+}
+
+template <class T, class = void>
+struct Hasher;
+
+//? 哈希函数声明 is_avalanching 表示输出的每一位都已充分混合, 容器可以直接取高位或低位定位, 不必再混合一次
+template <class Hash>
+inline constexpr bool is_avalanching_v = requires { typename Hash::is_avalanching; };
+
+template <class Hash>
+constexpr size_t _hash_mix(size_t h) noexcept
+{ //* 各哈希容器定位前调用: 未声明 is_avalanching 的哈希 (如对整数为恒等映射的 std::hash) 再混合一次, 避免高低位聚集
+    if constexpr (is_avalanching_v<Hash>)
+        return h;
+    else
+    {
+        h *= 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 32);
+    }
+}
+
+template <class... Ts>
+constexpr size_t hash_values(Ts const &...vals) noexcept
+{ //* 依次合并各个值的哈希, 用于手写自定义类型的哈希
+    size_t seed = sizeof...(Ts);
+    ((seed = hash_combine(seed, Hasher<Ts>()(vals))), ...);
+    return seed;
+}
+
+template <class T>
+struct Hasher<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+{
+    using is_avalanching = void;
+
+    constexpr size_t operator()(T x) const noexcept
+    {
+        return _hash_detail::hash_int(uint64_t(x));
+    }
+};
+
+template <class T>
+struct Hasher<T *>
+{
+    using is_avalanching = void;
+
+    size_t operator()(T *p) const noexcept
+    {
+        return _hash_detail::hash_int(uint64_t(reinterpret_cast<uintptr_t>(p)));
+    }
+};
+
+template <class T>
+struct Hasher<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+    using is_avalanching = void;
+
+    constexpr size_t operator()(T x) const noexcept
+    { //? 0.0 与 -0.0 相等, 哈希值也必须相同
+        if (x == T(0))
+            return _hash_detail::hash_int(0);
+        if constexpr (sizeof(T) <= 8)
+        {
+            using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            return _hash_detail::hash_int(uint64_t(std::bit_cast<Bits>(x)));
+        }
+        else
+            return _hash_detail::hash_int(std::hash<T>()(x));
+    }
+};
+
+struct _StringHasher
+{ //* string 与 string_view 共用, 声明 is_transparent 以便配合透明比较器做异构查找
+    using is_transparent = void;
+    using is_avalanching = void;
+
+    constexpr size_t operator()(std::string_view s) const noexcept
+    {
+        return hash_bytes(s);
+    }
+};
+
+template <class Traits, class Alloc>
+struct Hasher<std::basic_string<char, Traits, Alloc>> : _StringHasher
+{
+};
+
+template <class Traits>
+struct Hasher<std::basic_string_view<char, Traits>> : _StringHasher
+{
+};
+
+template <class A, class B>
+struct Hasher<std::pair<A, B>>
+{
+    using is_avalanching = void;
+
+    constexpr size_t operator()(std::pair<A, B> const &p) const noexcept
+    {
+        return hash_values(p.first, p.second);
+    }
+};
+
+template <class... Ts>
+struct Hasher<std::tuple<Ts...>>
+{
+    using is_avalanching = void;
+
+    constexpr size_t operator()(std::tuple<Ts...> const &t) const noexcept
+    {
+        return std::apply([](auto const &...vals) { return hash_values(vals...); }, t);
+    }
+};
+
+template <class T>
+concept _HashTieable = requires(T const &obj) { obj.tie(); };
+
+template <class T>
+struct Hasher<T, std::enable_if_t<_HashTieable<T>>>
+{ //* 结构体: 提供 auto tie() const { return std::tie(a, b, ...); } 即按成员逐个合并
+    using is_avalanching = void;
+
+    constexpr size_t operator()(T const &obj) const noexcept
+    {
+        return std::apply([](auto const &...vals) { return hash_values(vals...); }, obj.tie());
+    }
+};
+
+template <class T, class>
+struct Hasher
+{ //* 其他类型退回 std::hash 后再混合一次
+    using is_avalanching = void;
+
+    size_t operator()(T const &val) const noexcept(noexcept(std::hash<T>()(val)))
+    {
+        return _hash_detail::hash_int(std::hash<T>()(val));
+    }
+};
@@ -0,0 +1,821 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+#include "vector.hpp"
+#include "hash.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//?                             开放寻址哈希表 (Swiss table)  目的：元素平铺在一块连续数组里, 查找时按 16 个槽一组并行比较
+//?   每个槽对应一个控制字节: 空 (-128) / 已删除 (-2) / 已占用 (哈希值的高 7 位 h2, 0~127)
+//?   查找时用 SSE2 一次比较一组 16 个控制字节, 只有 h2 相同的槽才真正比较键; 组内出现空槽即可停止探测
+//?   删除时若所在组仍有空槽, 则任何键都不可能探测越过该组, 可以直接标记为空而不留墓碑
+//?   最大负载因子 7/8; 墓碑过多时原容量重建, 否则容量翻倍
+
+struct SwissGroup
+{
+    static constexpr size_t width = 16;
+    static constexpr int8_t empty = -128;
+    static constexpr int8_t deleted = -2;
+
+#if defined(__SSE2__)
+    __m128i m_ctrl;
+
+    explicit SwissGroup(int8_t const *ctrl) noexcept
+        : m_ctrl(_mm_load_si128(reinterpret_cast<__m128i const *>(ctrl))) {}
+
+    uint32_t match(int8_t h2) const noexcept
+    { //* 控制字节等于 h2 的槽的位掩码
+        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(m_ctrl, _mm_set1_epi8(h2)));
+    }
+
+    uint32_t match_empty() const noexcept
+    {
+        return match(empty);
+    }
+
+    uint32_t match_empty_or_deleted() const noexcept
+    { //? 空与已删除都小于 -1, 已占用的槽都非负
+        return (uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(m_ctrl, _mm_set1_epi8(-1)));
+    }
+#else
+    int8_t m_ctrl[width];
+
+    explicit SwissGroup(int8_t const *ctrl) noexcept
+    {
+        std::memcpy(m_ctrl, ctrl, width);
+    }
+
+    uint32_t match(int8_t h2) const noexcept
+    {
+        uint32_t mask = 0;
+        for (size_t i = 0; i != width; i++)
+            mask |= uint32_t(m_ctrl[i] == h2) << i;
+        return mask;
+    }
+
+    uint32_t match_empty() const noexcept
+    {
+        return match(empty);
+    }
+
+    uint32_t match_empty_or_deleted() const noexcept
+    {
+        uint32_t mask = 0;
+        for (size_t i = 0; i != width; i++)
+            mask |= uint32_t(m_ctrl[i] < -1) << i;
+        return mask;
+    }
+#endif
+};
+
+struct alignas(SwissGroup::width) SwissCtrlBlock
+{ //* 控制字节按组分配, 保证每组 16 字节对齐以便整组加载
+    int8_t m_bytes[SwissGroup::width];
+};
+
+//? 键比较器与哈希函数都声明了 is_transparent 时, 查找类接口接受任意可比较的键类型 (如用 string_view 查 string)
+template <class Hash, class KeyEqual>
+inline constexpr bool is_transparent_lookup_v = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+};
+
+template <class Slot, class Key, class KeyOf, class Hash, class KeyEqual, class Alloc>
+struct HashTable
+{
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Alloc;
+    using reference = Slot &;
+    using const_reference = Slot const &;
+
+protected:
+    using AllocSlot = std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using AllocCtrl = std::allocator_traits<Alloc>::template rebind_alloc<SwissCtrlBlock>;
+
+    static constexpr size_t width = SwissGroup::width;
+
+    //? 空表指向一组全空的静态控制字节, 查找不必特判
+    alignas(width) static inline int8_t const _empty_group[width] = {
+        -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128};
+
+    Slot *m_slots;
+    int8_t *m_ctrl;
+    size_t m_cap;         //? 槽数, 0 或 16 的 2 的幂倍
+    size_t m_size;
+    size_t m_growth_left; //? 还能占用多少个空槽才需要扩容 (墓碑也计入已用)
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_eq;
+    [[no_unique_address]] AllocSlot m_alloc;
+
+    static int8_t _h2(size_t h) noexcept
+    {
+        return int8_t(h >> 57);
+    }
+
+    size_t _group_mask() const noexcept
+    {
+        return m_cap == 0 ? 0 : m_cap / width - 1;
+    }
+
+    static size_t _max_load(size_t cap) noexcept
+    {
+        return cap - cap / 8;
+    }
+
+    static size_t _cap_for(size_t n) noexcept
+    { //* 容纳 n 个元素所需的最小槽数
+        if (n == 0)
+            return 0;
+        size_t cap = width;
+        while (_max_load(cap) < n)
+            cap *= 2;
+        return cap;
+    }
+
+    template <class K>
+    size_t _find_index(K const &key, size_t h) const
+    { //* 返回 key 所在槽的下标, 不存在时返回 m_cap
+        int8_t h2 = _h2(h);
+        size_t mask = _group_mask();
+        size_t g = h & mask;
+        for (size_t step = 1;; step++)
+        {
+            SwissGroup group(m_ctrl + g * width);
+            for (uint32_t bits = group.match(h2); bits != 0; bits &= bits - 1)
+            {
+                size_t idx = g * width + std::countr_zero(bits);
+                if (m_eq(KeyOf()(m_slots[idx]), key))
+                    return idx;
+            }
+            if (group.match_empty() != 0)
+                return m_cap;
+            g = (g + step) & mask; //? 按三角数跳组, 组数为 2 的幂时可遍历所有组
+        }
+    }
+
+    size_t _find_insert_slot(size_t h) const noexcept
+    { //* 沿探测序列找到第一个空或已删除的槽, 调用前需保证存在
+        size_t mask = _group_mask();
+        size_t g = h & mask;
+        for (size_t step = 1;; step++)
+        {
+            uint32_t bits = SwissGroup(m_ctrl + g * width).match_empty_or_deleted();
+            if (bits != 0)
+                return g * width + std::countr_zero(bits);
+            g = (g + step) & mask;
+        }
+    }
+
+    void _set_ctrl(size_t idx, int8_t h2) noexcept
+    {
+        m_ctrl[idx] = h2;
+    }
+
+    void _resize(size_t new_cap)
+    { //* 分配新数组并把所有元素搬过去, 同时清除全部墓碑
+        Slot *old_slots = m_slots;
+        int8_t *old_ctrl = m_ctrl;
+        size_t old_cap = m_cap;
+
+        if (new_cap == 0)
+        {
+            m_slots = NULL;
+            m_ctrl = const_cast<int8_t *>(_empty_group);
+        }
+        else
+        {
+            m_slots = m_alloc.allocate(new_cap);
+            try
+            {
+                m_ctrl = reinterpret_cast<int8_t *>(AllocCtrl(m_alloc).allocate(new_cap / width));
+            }
+            catch (...)
+            {
+                m_alloc.deallocate(m_slots, new_cap);
+                m_slots = old_slots;
+                throw;
+            }
+            std::memset(m_ctrl, SwissGroup::empty, new_cap);
+        }
+        m_cap = new_cap;
+        m_growth_left = _max_load(new_cap) - m_size;
+
+        for (size_t i = 0; i != old_cap; i++)
+        {
+            if (old_ctrl[i] < 0)
+                continue;
+            size_t h = _hash_mix<Hash>(m_hash(KeyOf()(old_slots[i])));
+            size_t idx = _find_insert_slot(h);
+            _set_ctrl(idx, _h2(h));
+            if constexpr (is_trivially_relocatable_v<Slot>)
+                std::memcpy(static_cast<void *>(&m_slots[idx]), static_cast<void const *>(&old_slots[i]), sizeof(Slot));
+            else
+            {
+                std::__construct_at(&m_slots[idx], std::move(old_slots[i]));
+                std::destroy_at(&old_slots[i]);
+            }
+        }
+        _deallocate(old_slots, old_ctrl, old_cap);
+    }
+
+    void _deallocate(Slot *slots, int8_t *ctrl, size_t cap) noexcept
+    {
+        if (cap == 0)
+            return;
+        m_alloc.deallocate(slots, cap);
+        AllocCtrl(m_alloc).deallocate(reinterpret_cast<SwissCtrlBlock *>(ctrl), cap / width);
+    }
+
+    void _destroy_all() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<Slot>)
+            for (size_t i = 0; i != m_cap; i++)
+                if (m_ctrl[i] >= 0)
+                    std::destroy_at(&m_slots[i]);
+    }
+
+    void _init() noexcept
+    {
+        m_slots = NULL;
+        m_ctrl = const_cast<int8_t *>(_empty_group);
+        m_cap = 0;
+        m_size = 0;
+        m_growth_left = 0;
+    }
+
+    void _grow()
+    { //* 没有空槽可用时调用: 墓碑占了一半以上就原容量重建, 否则翻倍
+        if (m_cap != 0 && m_size <= _max_load(m_cap) / 2)
+            _resize(m_cap);
+        else
+            _resize(m_cap == 0 ? width : m_cap * 2);
+    }
+
+    void _erase_index(size_t idx) noexcept
+    {
+        std::destroy_at(&m_slots[idx]);
+        m_size--;
+        if (SwissGroup(m_ctrl + idx / width * width).match_empty() != 0)
+        { //? 组内还有空槽, 没有键会越过本组继续探测, 直接置空
+            _set_ctrl(idx, SwissGroup::empty);
+            m_growth_left++;
+        }
+        else
+            _set_ctrl(idx, SwissGroup::deleted);
+    }
+
+    template <class K, class... Args>
+    std::pair<size_t, bool> _try_emplace_impl(K const &key, Args &&...args)
+    { //* 按 key 查找, 不存在时用 args 在槽中就地构造元素; key 在构造之前不再被使用
+        size_t h = _hash_mix<Hash>(m_hash(key));
+        size_t idx = _find_index(key, h);
+        if (idx != m_cap)
+            return {idx, false};
+        if (m_growth_left == 0)
+            _grow();
+        idx = _find_insert_slot(h);
+        std::__construct_at(&m_slots[idx], std::forward<Args>(args)...);
+        if (m_ctrl[idx] == SwissGroup::empty)
+            m_growth_left--;
+        _set_ctrl(idx, _h2(h));
+        m_size++;
+        return {idx, true};
+    }
+
+public:
+    template <class Value>
+    struct _iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Slot;
+        using difference_type = ptrdiff_t;
+        using pointer = Value *;
+        using reference = Value &;
+
+    private:
+        int8_t const *m_ctrl;
+        int8_t const *m_end;
+        Slot *m_slot;
+
+        friend HashTable;
+        template <class>
+        friend struct _iterator;
+
+        _iterator(int8_t const *ctrl, int8_t const *end, Slot *slot) noexcept
+            : m_ctrl(ctrl), m_end(end), m_slot(slot) {}
+
+        void _skip_empty() noexcept
+        {
+            while (m_ctrl != m_end && *m_ctrl < 0)
+            {
+                m_ctrl++;
+                m_slot++;
+            }
+        }
+
+    public:
+        _iterator() = default;
+
+        template <class Other>
+            requires std::is_const_v<Value> && (!std::is_const_v<Other>)
+        _iterator(_iterator<Other> const &that) noexcept
+            : m_ctrl(that.m_ctrl), m_end(that.m_end), m_slot(that.m_slot) {}
+
+        _iterator &operator++() noexcept
+        {
+            m_ctrl++;
+            m_slot++;
+            _skip_empty();
+            return *this;
+        }
+
+        _iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Value &operator*() const noexcept
+        {
+            return *m_slot;
+        }
+
+        Value *operator->() const noexcept
+        {
+            return m_slot;
+        }
+
+        bool operator==(_iterator const &that) const noexcept
+        {
+            return m_ctrl == that.m_ctrl;
+        }
+
+        bool operator!=(_iterator const &that) const noexcept
+        {
+            return m_ctrl != that.m_ctrl;
+        }
+    };
+
+    using iterator = _iterator<Slot>;
+    using const_iterator = _iterator<Slot const>;
+
+protected:
+    iterator _make_iter(size_t idx) const noexcept
+    {
+        return iterator{m_ctrl + idx, m_ctrl + m_cap, m_slots + idx};
+    }
+
+public:
+    HashTable()
+    {
+        _init();
+    }
+
+    explicit HashTable(size_t n, Hash const &hash = Hash(), KeyEqual const &eq = KeyEqual(),
+                       Alloc const &alloc = Alloc())
+        : m_hash(hash), m_eq(eq), m_alloc(alloc)
+    {
+        _init();
+        reserve(n);
+    }
+
+    explicit HashTable(Alloc const &alloc) : m_alloc(alloc)
+    {
+        _init();
+    }
+
+    HashTable(HashTable const &that)
+        : m_hash(that.m_hash), m_eq(that.m_eq),
+          m_alloc(std::allocator_traits<AllocSlot>::select_on_container_copy_construction(that.m_alloc))
+    {
+        _init();
+        reserve(that.m_size);
+        for (auto const &val : that)
+            insert(val);
+    }
+
+    HashTable(HashTable &&that) noexcept
+        : m_slots(that.m_slots), m_ctrl(that.m_ctrl), m_cap(that.m_cap), m_size(that.m_size),
+          m_growth_left(that.m_growth_left), m_hash(std::move(that.m_hash)), m_eq(std::move(that.m_eq)),
+          m_alloc(std::move(that.m_alloc))
+    {
+        that._init();
+    }
+
+    HashTable &operator=(HashTable const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        reserve(that.m_size);
+        for (auto const &val : that)
+            insert(val);
+        return *this;
+    }
+
+    HashTable &operator=(HashTable &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        _destroy_all();
+        _deallocate(m_slots, m_ctrl, m_cap);
+        m_slots = that.m_slots;
+        m_ctrl = that.m_ctrl;
+        m_cap = that.m_cap;
+        m_size = that.m_size;
+        m_growth_left = that.m_growth_left;
+        m_hash = std::move(that.m_hash);
+        m_eq = std::move(that.m_eq);
+        m_alloc = std::move(that.m_alloc);
+        that._init();
+        return *this;
+    }
+
+    ~HashTable()
+    {
+        _destroy_all();
+        _deallocate(m_slots, m_ctrl, m_cap);
+    }
+
+    void swap(HashTable &that) noexcept
+    {
+        std::swap(m_slots, that.m_slots);
+        std::swap(m_ctrl, that.m_ctrl);
+        std::swap(m_cap, that.m_cap);
+        std::swap(m_size, that.m_size);
+        std::swap(m_growth_left, that.m_growth_left);
+        std::swap(m_hash, that.m_hash);
+        std::swap(m_eq, that.m_eq);
+        std::swap(m_alloc, that.m_alloc);
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    size_t capacity() const noexcept
+    {
+        return m_cap;
+    }
+
+    size_t bucket_count() const noexcept
+    {
+        return m_cap;
+    }
+
+    float load_factor() const noexcept
+    {
+        return m_cap == 0 ? 0.0f : float(m_size) / float(m_cap);
+    }
+
+    float max_load_factor() const noexcept
+    {
+        return 7.0f / 8.0f;
+    }
+
+    hasher hash_function() const
+    {
+        return m_hash;
+    }
+
+    key_equal key_eq() const
+    {
+        return m_eq;
+    }
+
+    void clear() noexcept
+    { //* 保留容量, 控制字节全部置空
+        _destroy_all();
+        if (m_cap != 0)
+            std::memset(m_ctrl, SwissGroup::empty, m_cap);
+        m_size = 0;
+        m_growth_left = _max_load(m_cap);
+    }
+
+    void reserve(size_t n)
+    { //* 之后插入到 n 个元素为止都不会重新分配
+        size_t cap = _cap_for(n);
+        if (cap > m_cap)
+            _resize(cap);
+    }
+
+    void rehash(size_t n)
+    { //* 槽数调整为至少 n 且能容纳当前元素的最小值, 可用于收缩
+        size_t cap = std::max(_cap_for(m_size), n == 0 ? 0 : std::bit_ceil(std::max(n, width)));
+        if (cap != m_cap || m_growth_left != _max_load(m_cap) - m_size)
+            _resize(cap);
+    }
+
+    iterator begin() noexcept
+    {
+        iterator it = _make_iter(0);
+        it._skip_empty();
+        return it;
+    }
+
+    iterator end() noexcept
+    {
+        return _make_iter(m_cap);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_cast<HashTable *>(this)->begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return _make_iter(m_cap);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    iterator find(Key const &key)
+    {
+        return _make_iter(_find_index(key, _hash_mix<Hash>(m_hash(key))));
+    }
+
+    const_iterator find(Key const &key) const
+    {
+        return _make_iter(_find_index(key, _hash_mix<Hash>(m_hash(key))));
+    }
+
+    template <class K>
+        requires is_transparent_lookup_v<Hash, KeyEqual>
+    iterator find(K const &key)
+    {
+        return _make_iter(_find_index(key, _hash_mix<Hash>(m_hash(key))));
+    }
+
+    template <class K>
+        requires is_transparent_lookup_v<Hash, KeyEqual>
+    const_iterator find(K const &key) const
+    {
+        return _make_iter(_find_index(key, _hash_mix<Hash>(m_hash(key))));
+    }
+
+    bool contains(Key const &key) const
+    {
+        return _find_index(key, _hash_mix<Hash>(m_hash(key))) != m_cap;
+    }
+
+    template <class K>
+        requires is_transparent_lookup_v<Hash, KeyEqual>
+    bool contains(K const &key) const
+    {
+        return _find_index(key, _hash_mix<Hash>(m_hash(key))) != m_cap;
+    }
+
+    size_t count(Key const &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class K>
+        requires is_transparent_lookup_v<Hash, KeyEqual>
+    size_t count(K const &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    std::pair<iterator, bool> insert(Slot const &val)
+    {
+        auto [idx, inserted] = _try_emplace_impl(KeyOf()(val), val);
+        return {_make_iter(idx), inserted};
+    }
+
+    std::pair<iterator, bool> insert(Slot &&val)
+    {
+        auto [idx, inserted] = _try_emplace_impl(KeyOf()(val), std::move(val));
+        return {_make_iter(idx), inserted};
+    }
+
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+            reserve(m_size + std::distance(first, last));
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    void insert(std::initializer_list<Slot> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args)
+    { //* 先构造出元素才能得到键, 键已存在时丢弃
+        Slot tmp(std::forward<Args>(args)...);
+        return insert(std::move(tmp));
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    {
+        size_t idx = pos.m_ctrl - m_ctrl;
+        _erase_index(idx);
+        iterator it = _make_iter(idx);
+        it._skip_empty();
+        return it;
+    }
+
+    iterator erase(iterator pos) noexcept
+    {
+        return erase(const_iterator(pos));
+    }
+
+    size_t erase(Key const &key)
+    {
+        size_t idx = _find_index(key, _hash_mix<Hash>(m_hash(key)));
+        if (idx == m_cap)
+            return 0;
+        _erase_index(idx);
+        return 1;
+    }
+
+    template <class K>
+        requires is_transparent_lookup_v<Hash, KeyEqual> &&
+                 (!std::is_convertible_v<K, const_iterator>) && (!std::is_convertible_v<K, iterator>)
+    size_t erase(K const &key)
+    {
+        size_t idx = _find_index(key, _hash_mix<Hash>(m_hash(key)));
+        if (idx == m_cap)
+            return 0;
+        _erase_index(idx);
+        return 1;
+    }
+
+    template <class Pred>
+    size_t erase_if(Pred pred)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i != m_cap; i++)
+            if (m_ctrl[i] >= 0 && pred(std::as_const(m_slots[i])))
+            {
+                _erase_index(i);
+                count++;
+            }
+        return count;
+    }
+
+    bool operator==(HashTable const &that) const
+    { //* 元素个数相同且本表每个元素都能在对方中找到相等的元素
+        if (m_size != that.m_size)
+            return false;
+        for (auto const &val : *this)
+        {
+            auto it = that.find(KeyOf()(val));
+            if (it == that.end() || !(*it == val))
+                return false;
+        }
+        return true;
+    }
+};
+
+struct _MapKeyOf
+{
+    template <class Pair>
+    auto const &operator()(Pair const &kv) const noexcept
+    {
+        return kv.first;
+    }
+};
+
+struct _SetKeyOf
+{
+    template <class K>
+    K const &operator()(K const &key) const noexcept
+    {
+        return key;
+    }
+};
+
+//? HashMap 的元素类型为 std::pair<Key, Value>, 搬迁时可以移动键; 通过迭代器修改 first 的行为未定义
+template <class Key, class Value, class Hash = Hasher<Key>, class KeyEqual = std::equal_to<Key>,
+          class Alloc = std::allocator<std::pair<Key, Value>>>
+struct HashMap : HashTable<std::pair<Key, Value>, Key, _MapKeyOf, Hash, KeyEqual, Alloc>
+{
+private:
+    using Base = HashTable<std::pair<Key, Value>, Key, _MapKeyOf, Hash, KeyEqual, Alloc>;
+
+public:
+    using mapped_type = Value;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+    using Base::Base;
+
+    HashMap() = default;
+
+    HashMap(std::initializer_list<std::pair<Key, Value>> ilist)
+    {
+        this->insert(ilist);
+    }
+
+    template <class K, class... Args>
+    std::pair<iterator, bool> try_emplace(K &&key, Args &&...args)
+    { //* 键不存在时才构造值
+        auto [idx, inserted] = this->_try_emplace_impl(
+            key, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->_make_iter(idx), inserted};
+    }
+
+    template <class K, class V>
+    std::pair<iterator, bool> insert_or_assign(K &&key, V &&val)
+    {
+        auto res = try_emplace(std::forward<K>(key), std::forward<V>(val));
+        if (!res.second)
+            res.first->second = std::forward<V>(val);
+        return res;
+    }
+
+    Value &operator[](Key const &key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    Value &operator[](Key &&key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    Value &at(Key const &key)
+    {
+        auto it = this->find(key);
+        if (it == this->end()) [[unlikely]]
+            throw std::out_of_range("HashMap::at");
+        return it->second;
+    }
+
+    Value const &at(Key const &key) const
+    {
+        auto it = this->find(key);
+        if (it == this->end()) [[unlikely]]
+            throw std::out_of_range("HashMap::at");
+        return it->second;
+    }
+};
+
+template <class Key, class Hash = Hasher<Key>, class KeyEqual = std::equal_to<Key>, class Alloc = std::allocator<Key>>
+struct HashSet : HashTable<Key, Key, _SetKeyOf, Hash, KeyEqual, Alloc>
+{
+private:
+    using Base = HashTable<Key, Key, _SetKeyOf, Hash, KeyEqual, Alloc>;
+
+public:
+    using Base::Base;
+
+    HashSet() = default;
+
+    HashSet(std::initializer_list<Key> ilist)
+    {
+        this->insert(ilist);
+    }
+};
+
+template <class Key, class Value, class Hash, class KeyEqual, class Alloc, class Pred>
+size_t erase_if(HashMap<Key, Value, Hash, KeyEqual, Alloc> &map, Pred pred)
+{
+    return map.erase_if(pred);
+}
+
+template <class Key, class Hash, class KeyEqual, class Alloc, class Pred>
+size_t erase_if(HashSet<Key, Hash, KeyEqual, Alloc> &set, Pred pred)
+{
+    return set.erase_if(pred);
+}
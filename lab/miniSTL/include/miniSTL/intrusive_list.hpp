@@ -0,0 +1,496 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+#include <tuple>
+
+//?                             侵入式链表 IntrusiveList  目的：节点就嵌在用户对象里, 入链出链不分配内存
+//?   用户对象内嵌一个 IntrusiveListHook 成员 (布局同 ListBaseNode: m_next, m_prev), 用 IntrusiveList<T, &T::hook> 串起来
+//?   一个对象可以有多个 hook, 同时挂在多条链表上; 链表不拥有对象, 对象的生命周期由用户管理
+//?   AutoUnlink = true 时为安全模式: hook 析构时自动出链, 但此时链表不再维护元素个数, size() 为 O(n)
+//?   T 须为标准布局类型: 由 hook 地址反推对象地址依赖 hook 在 T 中的固定偏移, 虚基类等情形下偏移不固定
+
+template <class T, auto Member>
+size_t _member_offset() noexcept
+{ //* 成员 Member 在 T 中的字节偏移, 侵入式容器 (IntrusiveList, MpscIntrusiveQueue) 共用
+    union Probe
+    { //? 只取成员地址, 从不构造 T
+        char m_bytes[sizeof(T)];
+        T m_obj;
+
+        constexpr Probe() : m_bytes{} {}
+        constexpr ~Probe() {}
+    };
+    static constinit Probe const probe;
+    return reinterpret_cast<char const *>(&(probe.m_obj.*Member)) - probe.m_bytes;
+}
+
+template <bool AutoUnlink = false>
+struct IntrusiveListHook
+{
+    IntrusiveListHook *m_next = nullptr;
+    IntrusiveListHook *m_prev = nullptr;
+
+    static constexpr bool auto_unlink = AutoUnlink;
+
+    IntrusiveListHook() = default;
+
+    //? 复制对象不复制链接关系, 新对象总是不在任何链表上
+    IntrusiveListHook(IntrusiveListHook const &) noexcept {}
+
+    IntrusiveListHook &operator=(IntrusiveListHook const &) noexcept
+    {
+        return *this;
+    }
+
+    ~IntrusiveListHook()
+    {
+        if constexpr (AutoUnlink)
+            unlink();
+    }
+
+    bool is_linked() const noexcept
+    {
+        return m_next != nullptr;
+    }
+
+    void unlink() noexcept
+    { //* 直接从所在链表摘下, O(1); 非安全模式下应通过 IntrusiveList::erase 摘除以维护 size
+        if (m_next == nullptr)
+            return;
+        m_prev->m_next = m_next;
+        m_next->m_prev = m_prev;
+        m_next = nullptr;
+        m_prev = nullptr;
+    }
+};
+
+template <class T, auto Member>
+struct IntrusiveList
+{
+    using Hook = std::remove_cvref_t<decltype(std::declval<T &>().*Member)>;
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using reference = T &;
+    using const_reference = T const &;
+
+    static constexpr bool auto_unlink = Hook::auto_unlink;
+
+private:
+    Hook m_dummy;
+    [[no_unique_address]] std::conditional_t<auto_unlink, std::tuple<>, size_t> m_size{};
+
+    static T *_owner(Hook *hook) noexcept
+    { //* 由 hook 地址减去成员偏移得到所属对象; 断言写在这里, T 的定义中仍可包含以 T 为元素的链表
+        static_assert(std::is_standard_layout_v<T>, "IntrusiveList: T must be a standard-layout type");
+        return reinterpret_cast<T *>(reinterpret_cast<char *>(hook) - _member_offset<T, Member>());
+    }
+
+    static T const *_owner(Hook const *hook) noexcept
+    {
+        return reinterpret_cast<T const *>(reinterpret_cast<char const *>(hook) - _member_offset<T, Member>());
+    }
+
+    static Hook *_hook(T &obj) noexcept
+    {
+        return &(obj.*Member);
+    }
+
+    void _init() noexcept
+    {
+        m_dummy.m_next = &m_dummy;
+        m_dummy.m_prev = &m_dummy;
+        if constexpr (!auto_unlink)
+            m_size = 0;
+    }
+
+    void _link_before(Hook *next, Hook *hook) noexcept
+    {
+        Hook *prev = next->m_prev;
+        hook->m_prev = prev;
+        hook->m_next = next;
+        prev->m_next = hook;
+        next->m_prev = hook;
+        if constexpr (!auto_unlink)
+            m_size++;
+    }
+
+    void _relink_dummy(Hook *old) noexcept
+    {
+        if (m_dummy.m_next == old)
+        {
+            m_dummy.m_next = &m_dummy;
+            m_dummy.m_prev = &m_dummy;
+            return;
+        }
+        m_dummy.m_next->m_prev = &m_dummy;
+        m_dummy.m_prev->m_next = &m_dummy;
+    }
+
+public:
+    struct iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        Hook *m_curr;
+
+        friend IntrusiveList;
+
+        explicit iterator(Hook *curr) noexcept : m_curr(curr) {}
+
+    public:
+        iterator() = default;
+
+        iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        iterator &operator--() noexcept
+        {
+            m_curr = m_curr->m_prev;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T &operator*() const noexcept
+        {
+            return *_owner(m_curr);
+        }
+
+        T *operator->() const noexcept
+        {
+            return _owner(m_curr);
+        }
+
+        bool operator==(iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    struct const_iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T const *;
+        using reference = T const &;
+
+    private:
+        Hook const *m_curr;
+
+        friend IntrusiveList;
+
+        explicit const_iterator(Hook const *curr) noexcept : m_curr(curr) {}
+
+    public:
+        const_iterator() = default;
+
+        const_iterator(iterator that) noexcept : m_curr(that.m_curr) {}
+
+        const_iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        const_iterator &operator--() noexcept
+        {
+            m_curr = m_curr->m_prev;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T const &operator*() const noexcept
+        {
+            return *_owner(m_curr);
+        }
+
+        T const *operator->() const noexcept
+        {
+            return _owner(m_curr);
+        }
+
+        bool operator==(const_iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(const_iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using reverse_const_iterator = std::reverse_iterator<const_iterator>;
+
+    IntrusiveList() noexcept
+    {
+        _init();
+    }
+
+    IntrusiveList(IntrusiveList const &) = delete;
+    IntrusiveList &operator=(IntrusiveList const &) = delete;
+
+    IntrusiveList(IntrusiveList &&that) noexcept
+    {
+        _init();
+        swap(that);
+    }
+
+    IntrusiveList &operator=(IntrusiveList &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        swap(that);
+        return *this;
+    }
+
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    void swap(IntrusiveList &that) noexcept
+    {
+        std::swap(m_dummy.m_next, that.m_dummy.m_next);
+        std::swap(m_dummy.m_prev, that.m_dummy.m_prev);
+        std::swap(m_size, that.m_size);
+        _relink_dummy(&that.m_dummy);
+        that._relink_dummy(&m_dummy);
+    }
+
+    void clear() noexcept
+    { //* 只把所有 hook 置为未链接, 不析构对象
+        Hook *curr = m_dummy.m_next;
+        while (curr != &m_dummy)
+        {
+            Hook *next = curr->m_next;
+            curr->m_next = nullptr;
+            curr->m_prev = nullptr;
+            curr = next;
+        }
+        _init();
+    }
+
+    size_t size() const noexcept
+    {
+        if constexpr (auto_unlink)
+        {
+            size_t n = 0;
+            for (Hook const *curr = m_dummy.m_next; curr != &m_dummy; curr = curr->m_next)
+                n++;
+            return n;
+        }
+        else
+            return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_dummy.m_next == &m_dummy;
+    }
+
+    T &front() noexcept
+    {
+        return *_owner(m_dummy.m_next);
+    }
+
+    T const &front() const noexcept
+    {
+        return *_owner(m_dummy.m_next);
+    }
+
+    T &back() noexcept
+    {
+        return *_owner(m_dummy.m_prev);
+    }
+
+    T const &back() const noexcept
+    {
+        return *_owner(m_dummy.m_prev);
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{m_dummy.m_next};
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{&m_dummy};
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{m_dummy.m_next};
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{&m_dummy};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    reverse_const_iterator crbegin() const noexcept
+    {
+        return std::make_reverse_iterator(cend());
+    }
+
+    reverse_const_iterator crend() const noexcept
+    {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    //? 由对象直接得到它在本链表中的迭代器, 对象必须已在本链表上
+    iterator iterator_to(T &obj) noexcept
+    {
+        return iterator{_hook(obj)};
+    }
+
+    const_iterator iterator_to(T const &obj) const noexcept
+    {
+        return const_iterator{&(obj.*Member)};
+    }
+
+    iterator insert(const_iterator pos, T &obj) noexcept
+    { //* obj 当前不能在任何使用同一 hook 的链表上
+        Hook *hook = _hook(obj);
+        _link_before(const_cast<Hook *>(pos.m_curr), hook);
+        return iterator{hook};
+    }
+
+    void push_back(T &obj) noexcept
+    {
+        _link_before(&m_dummy, _hook(obj));
+    }
+
+    void push_front(T &obj) noexcept
+    {
+        _link_before(m_dummy.m_next, _hook(obj));
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    {
+        Hook *hook = const_cast<Hook *>(pos.m_curr);
+        Hook *next = hook->m_next;
+        hook->unlink();
+        if constexpr (!auto_unlink)
+            m_size--;
+        return iterator{next};
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        while (first != last)
+            first = erase(first);
+        return iterator{const_cast<Hook *>(last.m_curr)};
+    }
+
+    //? 直接按对象摘除, O(1), 无需先查找
+    void erase(T &obj) noexcept
+    {
+        erase(iterator_to(obj));
+    }
+
+    void pop_front() noexcept
+    {
+        erase(cbegin());
+    }
+
+    void pop_back() noexcept
+    {
+        erase(const_iterator{m_dummy.m_prev});
+    }
+
+    void splice(const_iterator pos, IntrusiveList &that) noexcept
+    { //* 把 that 的全部元素整段移到 pos 之前
+        if (that.empty() || &that == this)
+            return;
+        Hook *first = that.m_dummy.m_next;
+        Hook *last = that.m_dummy.m_prev;
+        Hook *next = const_cast<Hook *>(pos.m_curr);
+        Hook *prev = next->m_prev;
+        first->m_prev = prev;
+        prev->m_next = first;
+        last->m_next = next;
+        next->m_prev = last;
+        if constexpr (!auto_unlink)
+            m_size += that.m_size;
+        that._init();
+    }
+
+    void splice(const_iterator pos, IntrusiveList &that, const_iterator it) noexcept
+    { //* 把 that 中的单个元素移到 pos 之前, 常用于 LRU 的 "移到队首"
+        Hook *hook = const_cast<Hook *>(it.m_curr);
+        if (hook == pos.m_curr || hook->m_next == pos.m_curr)
+            return;
+        that.erase(it);
+        _link_before(const_cast<Hook *>(pos.m_curr), hook);
+    }
+};
@@ -8,6 +8,8 @@
 #include <utility>
 #include <compare>
 #include <initializer_list>
+#include <algorithm>
+#include <functional>
 
 template <class T>
 struct ListBaseNode
@@ -58,16 +60,17 @@ private:
 
     ListNode m_dummy;
     size_t m_size;
-    [[no_unique_address]] Alloc m_alloc;
+    [[no_unique_address]] AllocNode m_alloc;
+    //? 直接保存重绑定到节点类型的分配器, 有状态的分配器 (如 PoolAllocator) 不必每次分配都拷贝一份
 
     ListNode *newNode()
     {
-        return AllocNode{m_alloc}.allocate(1);
+        return m_alloc.allocate(1);
     }
 
     void deleteNode(ListNode *node) noexcept
     {
-        AllocNode{m_alloc}.deallocate(static_cast<ListValueNode<T> *>(node), 1);
+        m_alloc.deallocate(static_cast<ListValueNode<T> *>(node), 1);
     }
 
 private:
@@ -84,57 +87,94 @@ private:
     }
 
 private:
+    //? 分配器提供 allocate_bulk(n) (如 PoolAllocator) 时, 已知个数的批量构造一次取得 n 个地址连续的节点
+    //?   这些节点之后仍可逐个 deallocate; 返回 NULL 表示不支持, 退回逐个分配
+    static constexpr bool _can_allocate_bulk = requires(AllocNode &alloc, size_t n) { alloc.allocate_bulk(n); };
+
+    template <class Construct>
+    ListNode *_link_n(ListNode *pos, size_t n, Construct construct)
+    { //* 在 pos 之前按顺序接入 n 个新节点, construct(p) 在 p 处构造元素; 返回第一个新节点
+        ListNode *prev = pos->m_prev;
+        ListNode *first = pos;
+        if (n == 0)
+            return first;
+        ListValueNode<T> *block = NULL;
+        if constexpr (_can_allocate_bulk)
+            block = m_alloc.allocate_bulk(n);
+        size_t i = 0;
+        try
+        {
+            for (; i != n; i++)
+            {
+                ListNode *node = block != NULL ? static_cast<ListNode *>(&block[i]) : newNode();
+                try
+                {
+                    construct(&node->value());
+                }
+                catch (...)
+                {
+                    if (block == NULL)
+                        deleteNode(node);
+                    throw;
+                }
+                if (i == 0)
+                    first = node;
+                prev->m_next = node;
+                node->m_prev = prev;
+                prev = node;
+            }
+        }
+        catch (...)
+        { //? 已构造的节点保留在表中, 批量分配中剩余的节点逐个归还
+            prev->m_next = pos;
+            pos->m_prev = prev;
+            m_size += i;
+            if (block != NULL)
+                for (; i != n; i++)
+                    deleteNode(&block[i]);
+            throw;
+        }
+        prev->m_next = pos;
+        pos->m_prev = prev;
+        m_size += n;
+        return first;
+    }
+
     template <std::input_iterator InputIt>
     void _uninit_assign(InputIt first, InputIt last)
     {
         m_size = 0;
-        ListNode *prev = &m_dummy;
-        while (first != last)
+        m_dummy.m_next = &m_dummy;
+        m_dummy.m_prev = &m_dummy;
+        if constexpr (std::forward_iterator<InputIt>)
         {
-            ListNode *node = newNode();
-            prev->m_next = node;
-            node->m_prev = prev;
-            std::__construct_at(&node->value(), *first);
-            prev = node;
-            ++first;
-            ++m_size;
+            size_t n = std::distance(first, last);
+            _link_n(&m_dummy, n, [&](T *p)
+                    { std::__construct_at(p, *first); ++first; });
+        }
+        else
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
         }
-        m_dummy.m_prev = prev;
-        prev->m_next = &m_dummy;
     }
 
     void _uninit_assign(size_t n, T const &val)
     {
-        ListNode *prev = &m_dummy;
-        while (n)
-        {
-            ListNode *node = newNode();
-            prev->m_next = node;
-            node->m_prev = prev;
-            std::__construct_at(&node->value(), val);
-            prev = node;
-            --n;
-        }
-        m_dummy.m_prev = prev;
-        prev->m_next = &m_dummy;
-        m_size = n;
+        m_size = 0;
+        m_dummy.m_next = &m_dummy;
+        m_dummy.m_prev = &m_dummy;
+        _link_n(&m_dummy, n, [&](T *p)
+                { std::__construct_at(p, val); });
     }
 
     void _uninit_assign(size_t n)
     {
-        ListNode *prev = &m_dummy;
-        while (n)
-        {
-            ListNode *node = newNode();
-            prev->m_next = node;
-            node->m_prev = prev;
-            std::__construct_at(&node->value());
-            prev = node;
-            --n;
-        }
-        m_dummy.m_prev = prev;
-        prev->m_next = &m_dummy;
-        m_size = n;
+        m_size = 0;
+        m_dummy.m_next = &m_dummy;
+        m_dummy.m_prev = &m_dummy;
+        _link_n(&m_dummy, n, [&](T *p)
+                { std::__construct_at(p); });
     }
 
 public:
@@ -191,7 +231,8 @@ public:
         _uninit_move_assign(std::move(that));
     }
 
-    List(List const &that) : m_alloc(that.m_alloc)
+    List(List const &that)
+        : m_alloc(std::allocator_traits<AllocNode>::select_on_container_copy_construction(that.m_alloc))
     {
         _uninit_assign(that.cbegin(), that.cend());
     }
@@ -244,6 +285,7 @@ public:
 
     template <std::input_iterator InputIt>
     List(InputIt first, InputIt last, Alloc const &alloc = Alloc())
+        : m_alloc(alloc)
     {
         _uninit_assign(first, last);
     }
@@ -546,20 +588,299 @@ public:
         erase(std::prev(end()));
     }
 
-    size_t remove(T const &val)
+private:
+    static void _transfer(ListNode *pos, ListNode *first, ListNode *last) noexcept
+    { //* 把 [first, last) 这一段节点摘下, 接到 pos 之前, 只改指针
+        if (first == last || pos == first || pos == last)
+            return; //? 这一段已经在 pos 之前 (或 pos 就是段首), 不必移动; 否则节点会链到自己身上
+        ListNode *tail = last->m_prev;
+        first->m_prev->m_next = last;
+        last->m_prev = first->m_prev;
+        ListNode *prev = pos->m_prev;
+        prev->m_next = first;
+        first->m_prev = prev;
+        tail->m_next = pos;
+        pos->m_prev = tail;
+    }
+
+    template <class Compare>
+    static ListNode *_merge_chain(ListNode *a, ListNode *b, Compare &comp)
+    { //* 归并两条以 NULL 结尾、只用 m_next 串起的有序链, 相等时 a 在前以保持稳定
+        ListNode head;
+        ListNode *tail = &head;
+        while (a != NULL && b != NULL)
+        {
+            if (comp(std::as_const(b->value()), std::as_const(a->value())))
+            {
+                tail->m_next = b;
+                b = b->m_next;
+            }
+            else
+            {
+                tail->m_next = a;
+                a = a->m_next;
+            }
+            tail = tail->m_next;
+        }
+        tail->m_next = a != NULL ? a : b;
+        return head.m_next;
+    }
+
+public:
+    //? splice 系列: 把节点从 that 转移到 pos 之前, 不分配内存、不移动元素, 迭代器保持有效
+    //?   要求两个 List 的分配器相等; 整表与单个节点为 O(1), 跨表的区间需要 O(n) 统计个数
+    void splice(const_iterator pos, List &that) noexcept
+    {
+        if (&that == this || that.m_size == 0)
+            return;
+        _transfer(const_cast<ListNode *>(pos.m_curr), that.m_dummy.m_next, &that.m_dummy);
+        m_size += that.m_size;
+        that.m_size = 0;
+    }
+
+    void splice(const_iterator pos, List &&that) noexcept
+    {
+        splice(pos, that);
+    }
+
+    void splice(const_iterator pos, List &that, const_iterator it) noexcept
+    {
+        ListNode *node = const_cast<ListNode *>(it.m_curr);
+        _transfer(const_cast<ListNode *>(pos.m_curr), node, node->m_next);
+        if (&that != this)
+        {
+            ++m_size;
+            --that.m_size;
+        }
+    }
+
+    void splice(const_iterator pos, List &&that, const_iterator it) noexcept
+    {
+        splice(pos, that, it);
+    }
+
+    void splice(const_iterator pos, List &that, const_iterator first, const_iterator last) noexcept
+    {
+        if (&that != this)
+        {
+            size_t n = std::distance(first, last);
+            m_size += n;
+            that.m_size -= n;
+        }
+        _transfer(const_cast<ListNode *>(pos.m_curr), const_cast<ListNode *>(first.m_curr),
+                  const_cast<ListNode *>(last.m_curr));
+    }
+
+    void splice(const_iterator pos, List &&that, const_iterator first, const_iterator last) noexcept
     {
+        splice(pos, that, first, last);
+    }
+
+    template <class Compare = std::less<>>
+    void merge(List &that, Compare comp = Compare())
+    { //* 两表均已有序, 把 that 的节点逐段接入本表, 相等元素本表在前
+        if (&that == this)
+            return;
+        ListNode *curr = m_dummy.m_next;
+        ListNode *other = that.m_dummy.m_next;
+        while (curr != &m_dummy && other != &that.m_dummy)
+        {
+            if (comp(std::as_const(other->value()), std::as_const(curr->value())))
+            {
+                ListNode *next = other->m_next;
+                _transfer(curr, other, next);
+                other = next;
+            }
+            else
+                curr = curr->m_next;
+        }
+        _transfer(&m_dummy, other, &that.m_dummy);
+        m_size += that.m_size;
+        that.m_size = 0;
+    }
+
+    template <class Compare = std::less<>>
+    void merge(List &&that, Compare comp = Compare())
+    {
+        merge(that, comp);
+    }
+
+    template <class Compare = std::less<>>
+    void sort(Compare comp = Compare())
+    { //* 自底向上的稳定归并排序, 只重新链接节点指针, O(n log n) 且不分配内存
+        //? bins[i] 保存长度为 2^i 的有序段, 像二进制计数器一样逐级进位归并
+        if (m_size < 2)
+            return;
+        ListNode *bins[64] = {};
+        m_dummy.m_prev->m_next = NULL;
+        ListNode *curr = m_dummy.m_next;
+        while (curr != NULL)
+        {
+            ListNode *next = curr->m_next;
+            curr->m_next = NULL;
+            size_t i = 0;
+            for (; bins[i] != NULL; i++)
+            {
+                curr = _merge_chain(bins[i], curr, comp);
+                bins[i] = NULL;
+            }
+            bins[i] = curr;
+            curr = next;
+        }
+        ListNode *result = NULL;
+        for (size_t i = 0; i != 64; i++)
+            if (bins[i] != NULL)
+                result = result != NULL ? _merge_chain(bins[i], result, comp) : bins[i];
+        ListNode *prev = &m_dummy; //* 排序时只维护了 m_next, 最后顺序补齐 m_prev
+        for (curr = result; curr != NULL; curr = curr->m_next)
+        {
+            prev->m_next = curr;
+            curr->m_prev = prev;
+            prev = curr;
+        }
+        prev->m_next = &m_dummy;
+        m_dummy.m_prev = prev;
+    }
+
+private:
+    void _delete_chain(ListNode *node) noexcept
+    { //* 释放一条以 NULL 结尾、经 m_next 串起且元素已析构的节点链
+        while (node != NULL)
+        {
+            ListNode *next = node->m_next;
+            deleteNode(node);
+            node = next;
+        }
+    }
+
+public:
+    //? 把节点按遍历顺序重新分配到 (尽量) 连续的内存中, 类似 Vector::shrink_to_fit
+    //?   分配器提供 allocate_bulk 时新节点一次取得、严格连续; 否则逐个分配, 旧节点全部搬完后才释放, 避免新节点落回旧的空洞
+    //?   元素被移动到新节点, 所有迭代器、指针和引用均失效
+    void compact()
+    {
+        if (m_size == 0)
+            return;
+        ListValueNode<T> *block = NULL;
+        if constexpr (_can_allocate_bulk)
+            block = m_alloc.allocate_bulk(m_size);
+        ListNode *graveyard = NULL; //? 已搬空的旧节点, 经 m_next 串起, 最后统一释放
+        size_t i = 0;
+        try
+        {
+            for (ListNode *old = m_dummy.m_next; old != &m_dummy; i++)
+            {
+                ListNode *next = old->m_next;
+                ListNode *node = block != NULL ? static_cast<ListNode *>(&block[i]) : newNode();
+                try
+                {
+                    std::__construct_at(&node->value(), std::move_if_noexcept(old->value()));
+                }
+                catch (...)
+                {
+                    if (block == NULL)
+                        deleteNode(node);
+                    throw;
+                }
+                node->m_prev = old->m_prev;
+                node->m_next = next;
+                old->m_prev->m_next = node;
+                next->m_prev = node;
+                std::destroy_at(&old->value());
+                old->m_next = graveyard;
+                graveyard = old;
+                old = next;
+            }
+        }
+        catch (...)
+        { //? 已搬迁的前缀与未搬迁的后缀仍构成完整的链表
+            if (block != NULL)
+                for (; i != m_size; i++)
+                    deleteNode(&block[i]);
+            _delete_chain(graveyard);
+            throw;
+        }
+        _delete_chain(graveyard);
+    }
+
+    void reverse() noexcept
+    { //* 交换每个节点 (含哨兵) 的前后指针
+        ListNode *curr = &m_dummy;
+        do
+        {
+            std::swap(curr->m_next, curr->m_prev);
+            curr = curr->m_prev;
+        } while (curr != &m_dummy);
+    }
+
+    template <class Pred>
+    size_t remove_if(Pred pred)
+    { //* 单趟遍历, 每个被删除的节点 O(1) 摘除, 返回删除的个数
         auto first = begin();
-        auto last = begin();
+        auto last = end();
+        size_t count = 0;
+        while (first != last)
+        {
+            if (pred(std::as_const(*first)))
+            {
+                first = erase(first);
+                count++;
+            }
+            else
+                ++first;
+        }
+        return count;
+    }
+
+    size_t remove(T const &val)
+    {
+        //? val 可能就是某个节点里的值, 该节点推迟到遍历结束后再删除
+        ListNode *self = NULL;
         size_t count = 0;
+        auto first = begin();
+        auto last = end();
         while (first != last)
         {
             if (*first == val)
             {
+                if (&*first == &val)
+                {
+                    self = first.m_curr;
+                    ++first;
+                    continue;
+                }
                 first = erase(first);
                 count++;
             }
             else
-                first++;
+                ++first;
+        }
+        if (self != NULL)
+        {
+            erase(const_iterator{self});
+            count++;
+        }
+        return count;
+    }
+
+    template <class BinaryPred = std::equal_to<>>
+    size_t unique(BinaryPred pred = BinaryPred())
+    { //* 删除相邻的重复元素, 只保留每段中的第一个
+        size_t count = 0;
+        if (m_size == 0)
+            return 0;
+        auto prev = begin();
+        auto curr = std::next(prev);
+        auto last = end();
+        while (curr != last)
+        {
+            if (pred(std::as_const(*prev), std::as_const(*curr)))
+            {
+                curr = erase(curr);
+                count++;
+            }
+            else
+                prev = curr++;
         }
         return count;
     }
@@ -591,20 +912,18 @@ public:
 
     iterator insert(const_iterator pos, size_t n, T const &val)
     {
-        auto orig = pos;
-        bool had_orig = false;
-        while (n)
-        {
-            pos = emplace(pos, val);
-            if (!had_orig)
-            {
-                had_orig = true;
-                orig = pos;
-            }
-            pos++;
-            n--;
-        }
-        return iterator(orig);
+        ListNode *first = _link_n(const_cast<ListNode *>(pos.m_curr), n, [&](T *p)
+                                  { std::__construct_at(p, val); });
+        return iterator{first};
+    }
+
+    template <std::forward_iterator ForwardIt>
+    iterator insert(const_iterator pos, ForwardIt first, ForwardIt last)
+    {
+        size_t n = std::distance(first, last);
+        ListNode *node = _link_n(const_cast<ListNode *>(pos.m_curr), n, [&](T *p)
+                                 { std::__construct_at(p, *first); ++first; });
+        return iterator{node};
     }
 
     template <std::input_iterator InputIt>
@@ -650,4 +969,21 @@ public:
 
         return true;
     }
+
+    auto operator<=>(List const &that) const
+    { //* 字典序三路比较, 节点不连续, 只能逐个元素比较
+        return std::lexicographical_compare_three_way(cbegin(), cend(), that.cbegin(), that.cend());
+    }
 };
+
+template <class T, class Alloc, class Pred>
+size_t erase_if(List<T, Alloc> &lst, Pred pred)
+{
+    return lst.remove_if(pred);
+}
+
+template <class T, class Alloc>
+size_t erase(List<T, Alloc> &lst, T const &val)
+{
+    return lst.remove(val);
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <limits>
+#include <type_traits>
+#include <miniSTL/intrusive_list.hpp>
+
+//?                             无锁多生产者单消费者队列 (Vyukov MPSC)  目的：多个线程向一个消费者投递任务时不加锁
+//?   节点布局同 ListBaseNode / ListValueNode: 链接在前, 值放在 union 中; 只需单向链接, 链接换成 atomic
+//?   生产者 push 只有一次 exchange 和一次 store, 不会等待其他线程; 消费者 pop/drain 只能由一个线程调用
+//?   生产者执行到 exchange 与 store 之间时, 消费者暂时看不到该节点及其后的节点, 此时 pop 返回空, 稍后重试即可
+
+struct MpscHook
+{
+    std::atomic<MpscHook *> m_next{NULL};
+
+    MpscHook() = default;
+
+    //? 复制对象不复制链接关系
+    MpscHook(MpscHook const &) noexcept {}
+
+    MpscHook &operator=(MpscHook const &) noexcept
+    {
+        return *this;
+    }
+};
+
+template <class T>
+struct MpscValueNode : MpscHook
+{
+    union
+    {
+        T m_value;
+    };
+};
+
+struct MpscCore
+{ //* 只处理 hook 指针的队列核心, 侵入式与非侵入式队列共用
+private:
+    alignas(64) std::atomic<MpscHook *> m_head; //? 生产者交换的队尾
+    alignas(64) MpscHook *m_tail;               //? 消费者独占的队首
+    MpscHook m_stub;                            //? 队列为空时占位的哨兵节点
+
+public:
+    MpscCore() noexcept
+    {
+        m_head.store(&m_stub, std::memory_order_relaxed);
+        m_tail = &m_stub;
+    }
+
+    MpscCore(MpscCore const &) = delete;
+    MpscCore &operator=(MpscCore const &) = delete;
+
+    void push(MpscHook *node) noexcept
+    { //* 可由任意线程并发调用
+        node->m_next.store(NULL, std::memory_order_relaxed);
+        MpscHook *prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    MpscHook *pop() noexcept
+    { //* 仅消费者线程调用, 队列为空 (或生产者尚未链接完成) 时返回 NULL
+        MpscHook *tail = m_tail;
+        MpscHook *next = tail->m_next.load(std::memory_order_acquire);
+        if (tail == &m_stub)
+        { //? 跳过哨兵
+            if (next == NULL)
+                return NULL;
+            m_tail = next;
+            tail = next;
+            next = next->m_next.load(std::memory_order_acquire);
+        }
+        if (next != NULL)
+        {
+            m_tail = next;
+            return tail;
+        }
+        if (tail != m_head.load(std::memory_order_acquire))
+            return NULL;
+        //? tail 是最后一个节点: 重新放入哨兵, 让 tail 有后继后再取出
+        push(&m_stub);
+        next = tail->m_next.load(std::memory_order_acquire);
+        if (next != NULL)
+        {
+            m_tail = next;
+            return tail;
+        }
+        return NULL;
+    }
+
+    bool empty() const noexcept
+    { //* 仅消费者线程调用, 结果只是调用时刻的快照
+        return m_tail == &m_stub && m_stub.m_next.load(std::memory_order_acquire) == NULL;
+    }
+};
+
+template <class T, auto Member>
+struct MpscIntrusiveQueue
+{ //* 侵入式版本: 用户对象内嵌 MpscHook, 入队出队不分配内存, 队列不拥有对象; T 须为标准布局类型
+private:
+    MpscCore m_core;
+
+    static T *_owner(MpscHook *hook) noexcept
+    {
+        static_assert(std::is_standard_layout_v<T>, "MpscIntrusiveQueue: T must be a standard-layout type");
+        return reinterpret_cast<T *>(reinterpret_cast<char *>(hook) - _member_offset<T, Member>());
+    }
+
+public:
+    MpscIntrusiveQueue() = default;
+
+    void push(T &obj) noexcept
+    {
+        m_core.push(&(obj.*Member));
+    }
+
+    T *pop() noexcept
+    {
+        MpscHook *hook = m_core.pop();
+        return hook != NULL ? _owner(hook) : NULL;
+    }
+
+    template <class Func>
+    size_t drain(Func func, size_t max_count = std::numeric_limits<size_t>::max())
+    { //* 消费者一次取出当前可见的全部对象 (至多 max_count 个), 依次调用 func(T &), 返回个数
+        size_t count = 0;
+        for (; count != max_count; count++)
+        {
+            MpscHook *hook = m_core.pop();
+            if (hook == NULL)
+                break;
+            func(*_owner(hook));
+        }
+        return count;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_core.empty();
+    }
+};
+
+template <class T, class Alloc = std::allocator<T>>
+struct MpscQueue
+{ //* 非侵入式版本: 由队列分配节点并持有元素, 分配器需要支持多线程并发分配
+    using value_type = T;
+    using allocator_type = Alloc;
+
+private:
+    using Node = MpscValueNode<T>;
+    using AllocNode = std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+
+    MpscCore m_core;
+    [[no_unique_address]] AllocNode m_alloc;
+
+    void _delete_node(Node *node) noexcept
+    {
+        std::destroy_at(&node->m_value);
+        m_alloc.deallocate(node, 1);
+    }
+
+public:
+    MpscQueue() = default;
+
+    explicit MpscQueue(Alloc const &alloc) noexcept : m_alloc(alloc) {}
+
+    ~MpscQueue()
+    {
+        while (MpscHook *hook = m_core.pop())
+            _delete_node(static_cast<Node *>(hook));
+    }
+
+    template <class... Args>
+    void emplace(Args &&...args)
+    {
+        Node *node = m_alloc.allocate(1);
+        try
+        {
+            std::__construct_at(&node->m_value, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_alloc.deallocate(node, 1);
+            throw;
+        }
+        std::__construct_at(static_cast<MpscHook *>(node));
+        m_core.push(node);
+    }
+
+    void push(T const &val)
+    {
+        emplace(val);
+    }
+
+    void push(T &&val)
+    {
+        emplace(std::move(val));
+    }
+
+    bool try_pop(T &out)
+    {
+        MpscHook *hook = m_core.pop();
+        if (hook == NULL)
+            return false;
+        Node *node = static_cast<Node *>(hook);
+        out = std::move(node->m_value);
+        _delete_node(node);
+        return true;
+    }
+
+    template <class Func>
+    size_t drain(Func func, size_t max_count = std::numeric_limits<size_t>::max())
+    { //* 依次把元素以右值传给 func(T &&) 后释放节点, 返回个数
+        size_t count = 0;
+        for (; count != max_count; count++)
+        {
+            MpscHook *hook = m_core.pop();
+            if (hook == NULL)
+                break;
+            Node *node = static_cast<Node *>(hook);
+            try
+            {
+                func(std::move(node->m_value));
+            }
+            catch (...)
+            {
+                _delete_node(node);
+                throw;
+            }
+            _delete_node(node);
+        }
+        return count;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_core.empty();
+    }
+};
@@ -0,0 +1,723 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <initializer_list>
+#include <type_traits>
+#include <miniSTL/vector.hpp>
+
+//?                             小向量 SmallVector  目的：元素不多时免去堆分配
+//?   前 N 个元素存放在对象内部的缓冲区中, 超过 N 个时才和 Vector 一样转到堆上
+//?   接口与 Vector 相同, 并可以与 Vector 相互拷贝/移动 (堆上的缓冲区直接转交, 不复制元素)
+template <class T, size_t N = 8, class Alloc = std::allocator<T>, class GrowthPolicy = GrowthDouble>
+struct SmallVector
+{
+    static_assert(N != 0, "SmallVector: N must be positive, use Vector instead");
+
+    using value_type = T;
+    using allocator_type = Alloc;
+    using growth_policy = GrowthPolicy;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using reference = T &;
+    using const_reference = T const &;
+    using iterator = T *;
+    using const_iterator = T const *;
+    using reverse_iterator = std::reverse_iterator<T *>;
+    using const_reverse_iterator = std::reverse_iterator<T const *>;
+
+    static constexpr size_t inline_capacity = N;
+
+private:
+    using _Vector = Vector<T, Alloc, GrowthPolicy>; //* 复用 Vector 的填充 / 搬迁工具函数
+
+    //? 内部缓冲区中的元素只能逐个搬走; 移动构造可能抛出时 _relocate 会退回到复制, 不能再标记 noexcept
+    static constexpr bool nothrow_steal = std::is_nothrow_move_constructible_v<T> || is_trivially_relocatable_v<T>;
+
+    T *m_data;
+    size_t m_size;
+    size_t m_cap;
+    [[no_unique_address]] Alloc m_alloc;
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+
+    T *_inline_data() noexcept
+    {
+        return reinterpret_cast<T *>(m_inline);
+    }
+
+    void _init_inline() noexcept
+    {
+        m_data = _inline_data();
+        m_size = 0;
+        m_cap = N;
+    }
+
+    void _release() noexcept
+    { //* 析构所有元素并归还堆内存, 之后对象处于未初始化状态
+        for (size_t i = 0; i != m_size; i++)
+            std::destroy_at(&m_data[i]);
+        if (!is_small())
+            m_alloc.deallocate(m_data, m_cap);
+    }
+
+    void _realloc(size_t n)
+    { //* 把元素搬到容量恰为 n 的新位置, n <= N 时搬回内部缓冲区
+        T *new_data = n <= N ? _inline_data() : m_alloc.allocate(n);
+        if (new_data == m_data)
+            return;
+        _Vector::_relocate(new_data, m_data, m_size);
+        if (!is_small())
+            m_alloc.deallocate(m_data, m_cap);
+        m_data = new_data;
+        m_cap = n <= N ? N : n;
+    }
+
+    void _open_gap(size_t j, size_t n)
+    { //* 把 [j, m_size) 后移 n 位, 空出未初始化的 [j, j + n), 调用前需保证容量足够
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void *>(m_data + j + n), static_cast<void const *>(m_data + j),
+                         (m_size - j) * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = m_size; i != j; i--)
+            {
+                std::__construct_at(&m_data[i + n - 1], std::move(m_data[i - 1]));
+                std::destroy_at(&m_data[i - 1]);
+            }
+        }
+    }
+
+    void _close_gap(size_t j, size_t n) noexcept
+    { //* _open_gap 的逆操作: 把 [j + n, m_size + n) 移回 j 处
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void *>(m_data + j), static_cast<void const *>(m_data + j + n),
+                         (m_size - j) * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = j; i != m_size; i++)
+            {
+                std::__construct_at(&m_data[i], std::move(m_data[i + n]));
+                std::destroy_at(&m_data[i + n]);
+            }
+        }
+    }
+
+    template <class Get>
+    static void _construct_n(T *p, size_t n, Get get)
+    { //* 依次以 get(i) 构造 p[i]; 中途抛出异常时先析构已构造的元素, 不留下半初始化的区间
+        size_t i = 0;
+        try
+        {
+            for (; i != n; i++)
+                std::__construct_at(&p[i], get(i));
+        }
+        catch (...)
+        {
+            std::destroy(p, p + i);
+            throw;
+        }
+    }
+
+    template <class Construct>
+    T *_insert_n(size_t j, size_t n, Construct construct)
+    { //* 在 j 处插入 n 个元素, construct(p, n) 在未初始化的 p 处构造它们, 抛出异常时须已析构构造了的部分
+        //? 与 Vector 相同, 至多一次重新分配、一次尾部搬移: 容量不足时直接在新缓冲区里构造, 再把前后两段搬过去
+        if (n == 0) [[unlikely]]
+            return m_data + j;
+        if (m_size + n > m_cap)
+        {
+            size_t new_cap = GrowthPolicy::grow(m_cap, m_size + n);
+            T *new_data = m_alloc.allocate(new_cap);
+            try
+            {
+                construct(new_data + j, n);
+            }
+            catch (...)
+            {
+                m_alloc.deallocate(new_data, new_cap);
+                throw;
+            }
+            _Vector::_relocate(new_data, m_data, j);
+            _Vector::_relocate(new_data + j + n, m_data + j, m_size - j);
+            if (!is_small())
+                m_alloc.deallocate(m_data, m_cap);
+            m_data = new_data;
+            m_cap = new_cap;
+        }
+        else
+        {
+            _open_gap(j, n);
+            try
+            {
+                construct(m_data + j, n);
+            }
+            catch (...)
+            { //? 构造失败时把尾部移回原处, 元素个数不变
+                _close_gap(j, n);
+                throw;
+            }
+        }
+        m_size += n;
+        return m_data + j;
+    }
+
+    void _steal(SmallVector &that) noexcept(nothrow_steal)
+    { //* 本对象未初始化, 接管 that 的元素, that 变为空
+        if (that.is_small())
+        {
+            _init_inline();
+            _Vector::_relocate(m_data, that.m_data, that.m_size);
+            m_size = that.m_size;
+        }
+        else
+        {
+            m_data = that.m_data;
+            m_size = that.m_size;
+            m_cap = that.m_cap;
+        }
+        that._init_inline();
+    }
+
+    void _steal(_Vector &that) noexcept(nothrow_steal)
+    {
+        if (that.m_size <= N)
+        { //? 元素足够少时放进内部缓冲区, 归还 Vector 的堆内存
+            _init_inline();
+            _Vector::_relocate(m_data, that.m_data, that.m_size);
+            m_size = that.m_size;
+            if (that.m_cap != 0)
+                that.m_alloc.deallocate(that.m_data, that.m_cap);
+        }
+        else
+        {
+            m_data = that.m_data;
+            m_size = that.m_size;
+            m_cap = that.m_cap;
+        }
+        that.m_data = NULL;
+        that.m_size = 0;
+        that.m_cap = 0;
+    }
+
+public:
+    SmallVector()
+    {
+        _init_inline();
+    }
+
+    explicit SmallVector(Alloc const &alloc) : m_alloc(alloc)
+    {
+        _init_inline();
+    }
+
+    explicit SmallVector(size_t n, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        _init_inline();
+        resize(n);
+    }
+
+    SmallVector(size_t n, T const &val, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        _init_inline();
+        resize(n, val);
+    }
+
+    template <std::input_iterator InputIt>
+    SmallVector(InputIt first, InputIt last, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        _init_inline();
+        insert(end(), first, last);
+    }
+
+    SmallVector(std::initializer_list<T> ilist, Alloc const &alloc = Alloc())
+        : SmallVector(ilist.begin(), ilist.end(), alloc) {}
+
+    SmallVector(SmallVector const &that)
+        : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(that.m_alloc))
+    {
+        _init_inline();
+        insert(end(), that.begin(), that.end());
+    }
+
+    SmallVector(SmallVector &&that) noexcept(nothrow_steal) : m_alloc(that.m_alloc)
+    {
+        _steal(that);
+    }
+
+    SmallVector(_Vector const &that)
+        : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(that.m_alloc))
+    {
+        _init_inline();
+        insert(end(), that.begin(), that.end());
+    }
+
+    SmallVector(_Vector &&that) noexcept(nothrow_steal) : m_alloc(that.m_alloc)
+    {
+        _steal(that);
+    }
+
+    SmallVector &operator=(SmallVector const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        assign(that.begin(), that.end());
+        return *this;
+    }
+
+    //? 移动时接管 that 的堆缓冲区, 分配器也随之复制过来, 缓冲区总是由分配它的分配器释放
+    //?   复制而非移动分配器: that 之后仍要用它继续分配
+    SmallVector &operator=(SmallVector &&that) noexcept(nothrow_steal)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        _release();
+        m_alloc = that.m_alloc;
+        _steal(that);
+        return *this;
+    }
+
+    SmallVector &operator=(_Vector &&that) noexcept(nothrow_steal)
+    {
+        _release();
+        m_alloc = that.m_alloc;
+        _steal(that);
+        return *this;
+    }
+
+    SmallVector &operator=(std::initializer_list<T> ilist)
+    {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        _release();
+    }
+
+    operator _Vector() const &
+    {
+        return _Vector(begin(), end(), m_alloc);
+    }
+
+    operator _Vector() &&
+    { //* 已在堆上时直接把缓冲区交给 Vector
+        _Vector vec(m_alloc);
+        if (is_small())
+        {
+            vec.reserve(m_size);
+            _Vector::_relocate(vec.m_data, m_data, m_size);
+            vec.m_size = m_size;
+        }
+        else
+        {
+            vec.m_data = m_data;
+            vec.m_size = m_size;
+            vec.m_cap = m_cap;
+        }
+        _init_inline();
+        return vec;
+    }
+
+    bool is_small() const noexcept
+    { //* 元素是否仍存放在内部缓冲区中
+        return m_data == reinterpret_cast<T const *>(m_inline);
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i != m_size; i++)
+            std::destroy_at(&m_data[i]);
+        m_size = 0;
+    }
+
+    void resize(size_t n)
+    {
+        if (n < m_size)
+            for (size_t i = n; i != m_size; i++)
+                std::destroy_at(&m_data[i]);
+        else if (n > m_size)
+        {
+            reserve(n);
+            _Vector::_uninit_fill(m_data + m_size, n - m_size);
+        }
+        m_size = n;
+    }
+
+    void resize(size_t n, T const &val)
+    {
+        if (n < m_size)
+            for (size_t i = n; i != m_size; i++)
+                std::destroy_at(&m_data[i]);
+        else if (n > m_size)
+        {
+            if (n > m_cap)
+            { //? val 可能引用自身元素, 扩容前先复制一份
+                T tmp(val);
+                reserve(n);
+                _Vector::_uninit_fill(m_data + m_size, n - m_size, tmp);
+            }
+            else
+                _Vector::_uninit_fill(m_data + m_size, n - m_size, val);
+        }
+        m_size = n;
+    }
+
+    void resize_for_overwrite(size_t n)
+    {
+        if (n < m_size)
+            for (size_t i = n; i != m_size; i++)
+                std::destroy_at(&m_data[i]);
+        else if (n > m_size)
+        {
+            reserve(n);
+            if constexpr (!std::is_trivially_default_constructible_v<T>)
+                for (size_t i = m_size; i != n; i++)
+                    ::new (static_cast<void *>(&m_data[i])) T;
+        }
+        m_size = n;
+    }
+
+    void reserve(size_t n)
+    {
+        if (n > m_cap)
+            _realloc(n);
+    }
+
+    void shrink_to_fit()
+    { //* 元素个数不超过 N 时搬回内部缓冲区
+        if (!is_small() && m_size != m_cap)
+            _realloc(m_size);
+    }
+
+    size_t capacity() const
+    {
+        return m_cap;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    T const &operator[](size_t i) const
+    {
+        return m_data[i];
+    }
+
+    T &operator[](size_t i)
+    {
+        return m_data[i];
+    }
+
+    T const &at(size_t i) const
+    {
+        if (i >= m_size) [[unlikely]]
+            throw std::out_of_range("small_vector::at");
+        return m_data[i];
+    }
+
+    T &at(size_t i)
+    {
+        if (i >= m_size) [[unlikely]]
+            throw std::out_of_range("small_vector::at");
+        return m_data[i];
+    }
+
+    void swap(SmallVector &that)
+    {
+        SmallVector tmp(std::move(that));
+        that = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    T const &front() const
+    {
+        return *m_data;
+    }
+
+    T &front()
+    {
+        return *m_data;
+    }
+
+    T const &back() const
+    {
+        return m_data[m_size - 1];
+    }
+
+    T &back()
+    {
+        return m_data[m_size - 1];
+    }
+
+    template <class... Args>
+    T *_emplace_realloc(size_t j, Args &&...args)
+    { //* 与 Vector 相同: 先构造新元素, 再搬迁旧元素, 保证参数引用自身元素时仍然正确
+        size_t new_cap = GrowthPolicy::grow(m_cap, m_size + 1);
+        T *new_data = m_alloc.allocate(new_cap);
+        try
+        {
+            std::__construct_at(&new_data[j], std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_alloc.deallocate(new_data, new_cap);
+            throw;
+        }
+        _Vector::_relocate(new_data, m_data, j);
+        _Vector::_relocate(new_data + j + 1, m_data + j, m_size - j);
+        if (!is_small())
+            m_alloc.deallocate(m_data, m_cap);
+        m_data = new_data;
+        m_cap = new_cap;
+        m_size++;
+        return m_data + j;
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args)
+    {
+        if (m_size == m_cap) [[unlikely]]
+            return *_emplace_realloc(m_size, std::forward<Args>(args)...);
+        std::__construct_at(&m_data[m_size], std::forward<Args>(args)...);
+        m_size = m_size + 1;
+        return m_data[m_size - 1];
+    }
+
+    template <class... Args>
+    T *emplace(T const *it, Args &&...args)
+    {
+        size_t j = it - m_data;
+        if (m_size == m_cap) [[unlikely]]
+            return _emplace_realloc(j, std::forward<Args>(args)...);
+        if (j == m_size)
+        {
+            std::__construct_at(&m_data[m_size], std::forward<Args>(args)...);
+            m_size++;
+            return m_data + j;
+        }
+        T tmp(std::forward<Args>(args)...);
+        _open_gap(j, 1);
+        m_size++;
+        std::__construct_at(&m_data[j], std::move(tmp));
+        return m_data + j;
+    }
+
+    void push_back(T const &val)
+    {
+        emplace_back(val);
+    }
+
+    void push_back(T &&val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    void pop_back()
+    {
+        m_size--;
+        std::destroy_at(&m_data[m_size]);
+    }
+
+    T *data()
+    {
+        return m_data;
+    }
+
+    T const *data() const
+    {
+        return m_data;
+    }
+
+    T const *cdata() const
+    {
+        return m_data;
+    }
+
+    T *begin()
+    {
+        return m_data;
+    }
+
+    T *end()
+    {
+        return m_data + m_size;
+    }
+
+    T const *begin() const
+    {
+        return m_data;
+    }
+
+    T const *end() const
+    {
+        return m_data + m_size;
+    }
+
+    T const *cbegin() const
+    {
+        return m_data;
+    }
+
+    T const *cend() const
+    {
+        return m_data + m_size;
+    }
+
+    std::reverse_iterator<T *> rbegin()
+    {
+        return std::make_reverse_iterator(m_data + m_size);
+    }
+
+    std::reverse_iterator<T *> rend()
+    {
+        return std::make_reverse_iterator(m_data);
+    }
+
+    std::reverse_iterator<T const *> crbegin() const
+    {
+        return std::make_reverse_iterator(m_data + m_size);
+    }
+
+    std::reverse_iterator<T const *> crend() const
+    {
+        return std::make_reverse_iterator(m_data);
+    }
+
+    T *erase(T const *it) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        return erase(it, it + 1);
+    }
+
+    T *erase(T const *first, T const *last) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        size_t diff = last - first;
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            size_t i = first - m_data;
+            for (size_t j = i; j != i + diff; j++)
+                std::destroy_at(&m_data[j]);
+            std::memmove(static_cast<void *>(m_data + i), static_cast<void const *>(last),
+                         (m_size - i - diff) * sizeof(T));
+            m_size -= diff;
+        }
+        else
+        {
+            for (size_t j = last - m_data; j != m_size; j++)
+                m_data[j - diff] = std::move(m_data[j]);
+            m_size -= diff;
+            for (size_t j = m_size; j != m_size + diff; j++)
+                std::destroy_at(&m_data[j]);
+        }
+        return const_cast<T *>(first);
+    }
+
+    void assign(size_t n, T const &val)
+    {
+        T tmp(val);
+        clear();
+        resize(n, tmp);
+    }
+
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist)
+    {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    T *insert(T const *it, T &&val)
+    {
+        return emplace(it, std::move(val));
+    }
+
+    T *insert(T const *it, T const &val)
+    {
+        return emplace(it, val);
+    }
+
+    T *insert(T const *it, size_t n, T const &val)
+    {
+        size_t j = it - m_data;
+        if (n == 0) [[unlikely]]
+            return const_cast<T *>(it);
+        T tmp(val); //? val 可能引用自身元素, 腾出位置时会被移走
+        auto construct = [&](T *p, size_t n)
+        {
+            if constexpr (std::is_nothrow_copy_constructible_v<T>)
+                _Vector::_uninit_fill(p, n, tmp);
+            else
+                _construct_n(p, n, [&](size_t) -> T const & { return tmp; });
+        };
+        return _insert_n(j, n, construct);
+    }
+
+    template <std::input_iterator InputIt>
+    T *insert(T const *it, InputIt first, InputIt last)
+    {
+        size_t j = it - m_data;
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            size_t n = std::distance(first, last);
+            auto construct = [&](T *p, size_t n)
+            {
+                _construct_n(p, n, [&](size_t) -> decltype(auto) { return *first++; });
+            };
+            return _insert_n(j, n, construct);
+        }
+        else
+        { //* 输入迭代器只能遍历一次: 追加到末尾时逐个构造, 否则先缓存再整体移入
+            if (j == m_size)
+            {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+                return m_data + j;
+            }
+            SmallVector buf(m_alloc);
+            for (; first != last; ++first)
+                buf.emplace_back(*first);
+            auto construct = [&](T *p, size_t n)
+            {
+                _construct_n(p, n, [&](size_t i) -> T && { return std::move(buf.m_data[i]); });
+            };
+            return _insert_n(j, buf.m_size, construct);
+        }
+    }
+
+    T *insert(T const *it, std::initializer_list<T> ilist)
+    {
+        return insert(it, ilist.begin(), ilist.end());
+    }
+
+    bool operator==(SmallVector const &that) const
+    {
+        if (m_size != that.m_size)
+            return false;
+        return _range_equal(m_data, that.m_data, m_size);
+    }
+
+    auto operator<=>(SmallVector const &that) const
+    {
+        return _range_compare_3way(m_data, m_size, that.m_data, that.m_size);
+    }
+};
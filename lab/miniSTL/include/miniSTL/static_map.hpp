@@ -0,0 +1,255 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <utility>
+#include <string_view>
+#include <type_traits>
+#include <stdexcept>
+#include <miniSTL/hash.hpp>
+
+//?                             编译期完美哈希表 StaticMap  目的：固定不变的查找表 (操作码、关键字、字段名) 查询只需一次哈希加一次比较
+//?   在 consteval 构造函数中构建最小完美哈希 (CHD 式的 hash-and-displace): N 个键恰好放进 N 个槽, 不会冲突
+//?     键先按哈希值分到 N 个桶, 从大桶到小桶依次为每个桶寻找一个位移量 d, 使桶内键经 d 扰动后落到互不相同的空槽
+//?     只含一个键的桶最后处理, 直接记录剩余空槽的下标, 不必搜索位移量; 某个桶找不到位移量时换一个全局种子重新构建
+//?   查询: 哈希一次得到 h, 由 h 定位桶并取出位移量, 再由 h 与位移量算出唯一的候选槽, 比较一次键即可得出结果
+//?   默认哈希为 Hasher<Key>, 自定义的 Hash 需要 constexpr 的 operator(); 键和值需为可默认构造的字面类型, 重复的键在编译期报错
+
+inline constexpr uint64_t _static_fmix(uint64_t h) noexcept
+{ //* 把种子并入已有的哈希值; 双射, 不同的哈希值换种子后仍然不同
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+template <class Key, class Value, size_t N, class Hash = Hasher<Key>>
+struct StaticMap
+{
+    static_assert(N != 0, "StaticMap: key set must not be empty");
+    static_assert(N < (size_t(1) << 31), "StaticMap: too many keys");
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = size_t;
+    using const_iterator = value_type const *;
+    using iterator = const_iterator;
+    using hasher = Hash;
+
+private:
+    static constexpr size_t bucket_count = N;
+    static constexpr uint32_t max_displacement = 1u << 20; //? 超过后换种子
+    static constexpr uint32_t direct_bit = 1u << 31;       //? 位移量带此标记时低位即为槽号
+
+    std::array<value_type, N> m_slots;
+    std::array<uint32_t, bucket_count> m_disp;
+    uint64_t m_seed;
+
+    static constexpr size_t _reduce(uint64_t x, size_t n) noexcept
+    { //* 把 x 的高 32 位映射到 [0, n), 代替取模
+        return size_t(((x >> 32) * n) >> 32);
+    }
+
+    static constexpr size_t _bucket(uint64_t h) noexcept
+    {
+        return _reduce(h, bucket_count);
+    }
+
+    static constexpr size_t _displace(uint64_t h, uint32_t d) noexcept
+    {
+        return _reduce((h ^ (d * 0x9E3779B97F4A7C15ull)) * 0xD6E8FEB86659FD93ull, N);
+    }
+
+    constexpr size_t _slot(uint64_t h) const noexcept
+    {
+        uint32_t d = m_disp[_bucket(h)];
+        return d & direct_bit ? d ^ direct_bit : _displace(h, d);
+    }
+
+    template <class K>
+    static constexpr uint64_t _hash(K const &key, uint64_t seed) noexcept
+    {
+        return _static_fmix(uint64_t(Hash()(key)) ^ seed);
+    }
+
+    template <class A, class B>
+    static constexpr bool _key_eq(A const &a, B const &b) noexcept
+    { //* 两边都能转换为 string_view 时按字符串比较 (如 string_view 键与 char 数组)
+        if constexpr (std::is_convertible_v<A const &, std::string_view> && std::is_convertible_v<B const &, std::string_view>)
+            return std::string_view(a) == std::string_view(b);
+        else
+            return a == b;
+    }
+
+    constexpr bool _try_build(std::array<value_type, N> const &entries, uint64_t seed)
+    { //* 用给定种子构建一次, 失败返回 false
+        std::array<uint64_t, N> hashes{};
+        std::array<size_t, bucket_count + 1> start{};
+        std::array<size_t, N> order{};
+        for (size_t i = 0; i != N; i++)
+        {
+            hashes[i] = _hash(entries[i].first, seed);
+            start[_bucket(hashes[i]) + 1]++;
+        }
+        size_t max_size = 0;
+        for (size_t b = 0; b != bucket_count; b++)
+        {
+            if (start[b + 1] > max_size)
+                max_size = start[b + 1];
+            start[b + 1] += start[b];
+        }
+        { //? 按桶计数排序, order[start[b], start[b + 1]) 为桶 b 中的键
+            std::array<size_t, bucket_count> fill{};
+            for (size_t i = 0; i != N; i++)
+            {
+                size_t b = _bucket(hashes[i]);
+                order[start[b] + fill[b]++] = i;
+            }
+        }
+
+        std::array<bool, N> taken{};
+        std::array<size_t, 16> slots{};
+        if (max_size > slots.size())
+            return false;
+        for (size_t size = max_size; size > 1; size--)
+        { //? 大桶先放, 此时空槽多, 容易找到位移量
+            for (size_t b = 0; b != bucket_count; b++)
+            {
+                if (start[b + 1] - start[b] != size)
+                    continue;
+                uint32_t d = 0;
+                for (; d != max_displacement; d++)
+                {
+                    bool ok = true;
+                    for (size_t k = 0; k != size && ok; k++)
+                    {
+                        size_t i = order[start[b] + k];
+                        slots[k] = _displace(hashes[i], d);
+                        ok = !taken[slots[k]];
+                        for (size_t j = 0; j != k && ok; j++)
+                        {
+                            if (slots[j] != slots[k])
+                                continue;
+                            if (hashes[order[start[b] + j]] == hashes[i])
+                            { //? 哈希值完全相同时换种子也无法分开
+                                if (_key_eq(entries[order[start[b] + j]].first, entries[i].first))
+                                    throw std::invalid_argument("StaticMap: duplicate key");
+                                throw std::invalid_argument("StaticMap: 64-bit hash collision");
+                            }
+                            ok = false;
+                        }
+                    }
+                    if (ok)
+                        break;
+                }
+                if (d == max_displacement)
+                    return false;
+                m_disp[b] = d;
+                for (size_t k = 0; k != size; k++)
+                {
+                    taken[slots[k]] = true;
+                    m_slots[slots[k]] = entries[order[start[b] + k]];
+                }
+            }
+        }
+        size_t free_slot = 0;
+        for (size_t b = 0; b != bucket_count; b++)
+        { //? 单个键的桶依次占用剩余的空槽
+            if (start[b + 1] - start[b] != 1)
+                continue;
+            while (taken[free_slot])
+                free_slot++;
+            taken[free_slot] = true;
+            m_disp[b] = uint32_t(free_slot) | direct_bit;
+            m_slots[free_slot] = entries[order[start[b]]];
+        }
+        m_seed = seed;
+        return true;
+    }
+
+public:
+    consteval StaticMap(std::array<value_type, N> const &entries) : m_slots{}, m_disp{}, m_seed(0)
+    {
+        for (uint64_t seed = 0x243F6A8885A308D3ull;; seed = _static_fmix(seed + 1))
+            if (_try_build(entries, seed))
+                return;
+    }
+
+    static constexpr size_t size() noexcept
+    {
+        return N;
+    }
+
+    static constexpr bool empty() noexcept
+    {
+        return false;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    { //* 按槽的顺序遍历, 与构造时给出的顺序无关
+        return m_slots.data();
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return m_slots.data() + N;
+    }
+
+    template <class K>
+    constexpr const_iterator find(K const &key) const noexcept
+    { //* K 可以是 Hash 能接受且能与 Key 比较的类型, 如用 std::string 查 string_view 键
+        if constexpr (std::is_integral_v<Key> || std::is_enum_v<Key>)
+        { //? 先转换为 Key, 不同宽度的整数得到相同的哈希值; 转换后值或符号改变 (如 uint8_t 键查 256 或 -1) 的探测值不可能是键
+            Key k = Key(key);
+            if (K(k) != key || (k < Key()) != (key < K()))
+                return end();
+            size_t i = _slot(_hash(k, m_seed));
+            return m_slots[i].first == k ? &m_slots[i] : end();
+        }
+        else
+        {
+            size_t i = _slot(_hash(key, m_seed));
+            return _key_eq(m_slots[i].first, key) ? &m_slots[i] : end();
+        }
+    }
+
+    template <class K>
+    constexpr bool contains(K const &key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    template <class K>
+    constexpr size_t count(K const &key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class K>
+    constexpr Value const &at(K const &key) const
+    {
+        auto it = find(key);
+        if (it == end()) [[unlikely]]
+            throw std::out_of_range("StaticMap::at");
+        return it->second;
+    }
+
+    template <class K>
+    constexpr Value const &operator[](K const &key) const
+    {
+        return at(key);
+    }
+};
+
+template <class Key, class Value, size_t N>
+consteval StaticMap<Key, Value, N> make_static_map(std::pair<Key, Value> const (&entries)[N])
+{ //* make_static_map<std::string_view, int>({{"add", 1}, {"sub", 2}})
+    std::array<std::pair<Key, Value>, N> arr{};
+    for (size_t i = 0; i != N; i++)
+        arr[i] = entries[i];
+    return StaticMap<Key, Value, N>(arr);
+}
@@ -1,2 +1,16 @@
 #include <miniSTL/list.hpp>
 #include <miniSTL/vector.hpp>
+#include <miniSTL/small_vector.hpp>
+#include <miniSTL/allocator.hpp>
+#include <miniSTL/hash.hpp>
+#include <miniSTL/unrolled_list.hpp>
+#include <miniSTL/intrusive_list.hpp>
+#include <miniSTL/arena_list.hpp>
+#include <miniSTL/forward_list.hpp>
+#include <miniSTL/mpsc_queue.hpp>
+#include <miniSTL/hash_table.hpp>
+#include <miniSTL/concurrent_hash_map.hpp>
+#include <miniSTL/unordered_map.hpp>
+#include <miniSTL/static_map.hpp>
+#include <miniSTL/bloom_filter.hpp>
+#include <miniSTL/cuckoo_filter.hpp>
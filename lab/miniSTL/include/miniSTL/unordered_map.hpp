@@ -0,0 +1,757 @@
+#pragma once
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <initializer_list>
+#include <miniSTL/list.hpp>
+#include <miniSTL/allocator.hpp>
+#include <miniSTL/hash.hpp>
+
+//?                             链式哈希表 UnorderedMap  目的：扩容 (rehash) 时元素的指针、引用和迭代器都保持有效
+//?   全部元素串在一条带哨兵的双向链表上 (节点即 ListValueNode), 同一个桶的元素在链表上相邻, 桶数组只保存该桶的第一个节点
+//?     与 libstdc++ 相同的布局: 遍历整张表就是遍历链表, 不必扫描空桶
+//?   节点中缓存混合后的哈希值, 判断节点属于哪个桶、rehash 重新分桶时都不必再调用哈希函数
+//?   rehash 只重新串接已有节点, 不移动也不重新分配元素; 桶数取 2 的幂
+//?   默认用 PoolAllocator 分配节点, 反复插入删除时节点在池的空闲链表上复用
+
+template <class Value>
+struct _ChainEntry
+{ //* 链表节点中实际存放的内容: 哈希值与元素
+    size_t m_hash;
+    Value m_value;
+
+    template <class... Args>
+    _ChainEntry(size_t hash, Args &&...args) : m_hash(hash), m_value(std::forward<Args>(args)...) {}
+};
+
+template <class Key, class Value, class Hash = Hasher<Key>, class KeyEqual = std::equal_to<Key>,
+          class Alloc = PoolAllocator<std::pair<Key const, Value>>>
+struct UnorderedMap
+{
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key const, Value>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Alloc;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+
+private:
+    using Entry = _ChainEntry<value_type>;
+    using Node = ListBaseNode<Entry>;
+    using ValueNode = ListValueNode<Entry>;
+    using AllocNode = std::allocator_traits<Alloc>::template rebind_alloc<ValueNode>;
+    using AllocBucket = std::allocator_traits<Alloc>::template rebind_alloc<Node *>;
+
+    Node m_dummy;
+    Node **m_buckets;      //? m_buckets[b] 为桶 b 在链表上的第一个节点, 空桶为 NULL
+    size_t m_bucket_count; //? 0 或 2 的幂
+    size_t m_size;
+    float m_max_load;
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_eq;
+    [[no_unique_address]] AllocNode m_alloc;
+
+    static size_t _hash_of(Node const *node) noexcept
+    {
+        return node->value().m_hash;
+    }
+
+    size_t _bucket_of(size_t h) const noexcept
+    {
+        return h & (m_bucket_count - 1);
+    }
+
+    void _init() noexcept
+    {
+        m_dummy.m_next = m_dummy.m_prev = &m_dummy;
+        m_buckets = NULL;
+        m_bucket_count = 0;
+        m_size = 0;
+    }
+
+    void _relink_dummy(Node *old) noexcept
+    { //* 哨兵随对象移动后, 修正首尾节点指回哨兵的链接
+        if (m_dummy.m_next == old)
+            m_dummy.m_next = m_dummy.m_prev = &m_dummy;
+        else
+        {
+            m_dummy.m_next->m_prev = &m_dummy;
+            m_dummy.m_prev->m_next = &m_dummy;
+        }
+    }
+
+    void _free_buckets() noexcept
+    {
+        if (m_buckets != NULL)
+            AllocBucket(m_alloc).deallocate(m_buckets, m_bucket_count);
+    }
+
+    template <class... Args>
+    Node *_new_node(size_t h, Args &&...args)
+    {
+        ValueNode *node = m_alloc.allocate(1);
+        try
+        {
+            std::__construct_at(&node->m_value, h, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_alloc.deallocate(node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void _delete_node(Node *node) noexcept
+    {
+        std::destroy_at(&node->value());
+        m_alloc.deallocate(static_cast<ValueNode *>(node), 1);
+    }
+
+    void _link_before(Node *pos, Node *node) noexcept
+    {
+        node->m_next = pos;
+        node->m_prev = pos->m_prev;
+        pos->m_prev->m_next = node;
+        pos->m_prev = node;
+    }
+
+    void _link_bucket(Node *node) noexcept
+    { //* 把节点接到所属桶的最前面; 空桶的节点接到整条链表的最前面
+        Node *&head = m_buckets[_bucket_of(_hash_of(node))];
+        _link_before(head != NULL ? head : m_dummy.m_next, node);
+        head = node;
+    }
+
+    void _unlink_bucket(Node *node) noexcept
+    {
+        Node *&head = m_buckets[_bucket_of(_hash_of(node))];
+        if (head == node)
+        { //? 后继仍属于同一个桶时成为新的桶首, 否则桶变空
+            Node *next = node->m_next;
+            head = next != &m_dummy && _bucket_of(_hash_of(next)) == _bucket_of(_hash_of(node)) ? next : NULL;
+        }
+        node->m_prev->m_next = node->m_next;
+        node->m_next->m_prev = node->m_prev;
+    }
+
+    Node *_find_node(Key const &key, size_t h) const
+    {
+        if (m_size == 0)
+            return NULL;
+        size_t b = _bucket_of(h);
+        for (Node *node = m_buckets[b]; node != NULL && node != &m_dummy; node = node->m_next)
+        {
+            size_t nh = _hash_of(node);
+            if (_bucket_of(nh) != b)
+                break;
+            if (nh == h && m_eq(node->value().m_value.first, key))
+                return node;
+        }
+        return NULL;
+    }
+
+    void _rehash_to(size_t count)
+    { //* 重新分配桶数组并把全部节点按新桶数重新串接, 节点本身不动
+        Node **buckets = AllocBucket(m_alloc).allocate(count);
+        std::fill_n(buckets, count, (Node *)NULL);
+        Node *node = m_dummy.m_next;
+        m_dummy.m_next = m_dummy.m_prev = &m_dummy;
+        _free_buckets();
+        m_buckets = buckets;
+        m_bucket_count = count;
+        while (node != &m_dummy)
+        {
+            Node *next = node->m_next;
+            _link_bucket(node);
+            node = next;
+        }
+    }
+
+    size_t _buckets_for(size_t n) const noexcept
+    { //* 容纳 n 个元素且不超过最大负载因子所需的桶数
+        size_t need = (size_t)std::ceil((double)n / m_max_load);
+        return std::bit_ceil(need < 8 ? size_t(8) : need);
+    }
+
+    template <class... Args>
+    std::pair<Node *, bool> _try_emplace_impl(Key const &key, Args &&...args)
+    { //* key 已存在时不构造任何东西
+        size_t h = _hash_mix<Hash>(m_hash(key));
+        if (Node *node = _find_node(key, h))
+            return {node, false};
+        Node *node = _new_node(h, std::forward<Args>(args)...);
+        if (m_size + 1 > m_bucket_count * (double)m_max_load)
+        {
+            try
+            {
+                _rehash_to(_buckets_for(m_size + 1));
+            }
+            catch (...)
+            {
+                _delete_node(node);
+                throw;
+            }
+        }
+        _link_bucket(node);
+        m_size++;
+        return {node, true};
+    }
+
+public:
+    template <class T>
+    struct _iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        Node *m_curr;
+
+        friend UnorderedMap;
+        template <class>
+        friend struct _iterator;
+
+        explicit _iterator(Node *curr) noexcept : m_curr(curr) {}
+
+    public:
+        _iterator() = default;
+
+        template <class Other>
+            requires std::is_const_v<T> && (!std::is_const_v<Other>)
+        _iterator(_iterator<Other> const &that) noexcept : m_curr(that.m_curr) {}
+
+        _iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            return *this;
+        }
+
+        _iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        _iterator &operator--() noexcept
+        {
+            m_curr = m_curr->m_prev;
+            return *this;
+        }
+
+        _iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T &operator*() const noexcept
+        {
+            return m_curr->value().m_value;
+        }
+
+        T *operator->() const noexcept
+        {
+            return &m_curr->value().m_value;
+        }
+
+        bool operator==(_iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(_iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    template <class T>
+    struct _local_iterator
+    { //* 遍历单个桶: 走到链表上属于其他桶的节点时即为末尾 (NULL)
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        Node *m_curr;
+        Node const *m_dummy;
+        size_t m_bucket;
+        size_t m_mask;
+
+        friend UnorderedMap;
+
+        _local_iterator(Node *curr, Node const *dummy, size_t bucket, size_t mask) noexcept
+            : m_curr(curr), m_dummy(dummy), m_bucket(bucket), m_mask(mask) {}
+
+    public:
+        _local_iterator() = default;
+
+        _local_iterator &operator++() noexcept
+        {
+            m_curr = m_curr->m_next;
+            if (m_curr == m_dummy || (_hash_of(m_curr) & m_mask) != m_bucket)
+                m_curr = NULL;
+            return *this;
+        }
+
+        _local_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        T &operator*() const noexcept
+        {
+            return m_curr->value().m_value;
+        }
+
+        T *operator->() const noexcept
+        {
+            return &m_curr->value().m_value;
+        }
+
+        bool operator==(_local_iterator const &that) const noexcept
+        {
+            return m_curr == that.m_curr;
+        }
+
+        bool operator!=(_local_iterator const &that) const noexcept
+        {
+            return m_curr != that.m_curr;
+        }
+    };
+
+    using iterator = _iterator<value_type>;
+    using const_iterator = _iterator<value_type const>;
+    using local_iterator = _local_iterator<value_type>;
+    using const_local_iterator = _local_iterator<value_type const>;
+
+    UnorderedMap() : m_max_load(1.0f)
+    {
+        _init();
+    }
+
+    explicit UnorderedMap(size_t bucket_count, Hash const &hash = Hash(), KeyEqual const &eq = KeyEqual(),
+                          Alloc const &alloc = Alloc())
+        : m_max_load(1.0f), m_hash(hash), m_eq(eq), m_alloc(alloc)
+    {
+        _init();
+        rehash(bucket_count);
+    }
+
+    explicit UnorderedMap(Alloc const &alloc) : m_max_load(1.0f), m_alloc(alloc)
+    {
+        _init();
+    }
+
+    UnorderedMap(std::initializer_list<value_type> ilist) : UnorderedMap()
+    {
+        insert(ilist);
+    }
+
+    UnorderedMap(UnorderedMap const &that)
+        : m_max_load(that.m_max_load), m_hash(that.m_hash), m_eq(that.m_eq),
+          m_alloc(std::allocator_traits<AllocNode>::select_on_container_copy_construction(that.m_alloc))
+    {
+        _init();
+        try
+        {
+            reserve(that.m_size);
+            for (auto const &val : that)
+                insert(val);
+        }
+        catch (...)
+        {
+            clear();
+            _free_buckets();
+            throw;
+        }
+    }
+
+    UnorderedMap(UnorderedMap &&that) noexcept
+        : m_dummy(that.m_dummy), m_buckets(that.m_buckets), m_bucket_count(that.m_bucket_count),
+          m_size(that.m_size), m_max_load(that.m_max_load), m_hash(std::move(that.m_hash)),
+          m_eq(std::move(that.m_eq)), m_alloc(that.m_alloc)
+    {
+        _relink_dummy(&that.m_dummy);
+        that._init();
+    }
+
+    UnorderedMap &operator=(UnorderedMap const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        m_max_load = that.m_max_load;
+        reserve(that.m_size);
+        for (auto const &val : that)
+            insert(val);
+        return *this;
+    }
+
+    UnorderedMap &operator=(UnorderedMap &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        _free_buckets();
+        m_dummy = that.m_dummy;
+        m_buckets = that.m_buckets;
+        m_bucket_count = that.m_bucket_count;
+        m_size = that.m_size;
+        m_max_load = that.m_max_load;
+        m_hash = std::move(that.m_hash);
+        m_eq = std::move(that.m_eq);
+        m_alloc = that.m_alloc;
+        _relink_dummy(&that.m_dummy);
+        that._init();
+        return *this;
+    }
+
+    ~UnorderedMap()
+    {
+        clear();
+        _free_buckets();
+    }
+
+    void swap(UnorderedMap &that) noexcept
+    {
+        std::swap(m_dummy, that.m_dummy);
+        _relink_dummy(&that.m_dummy);
+        that._relink_dummy(&m_dummy);
+        std::swap(m_buckets, that.m_buckets);
+        std::swap(m_bucket_count, that.m_bucket_count);
+        std::swap(m_size, that.m_size);
+        std::swap(m_max_load, that.m_max_load);
+        std::swap(m_hash, that.m_hash);
+        std::swap(m_eq, that.m_eq);
+        std::swap(m_alloc, that.m_alloc);
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator{m_dummy.m_next};
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{&m_dummy};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{m_dummy.m_next};
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator{const_cast<Node *>(&m_dummy)};
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    iterator find(Key const &key)
+    {
+        Node *node = _find_node(key, _hash_mix<Hash>(m_hash(key)));
+        return node != NULL ? iterator{node} : end();
+    }
+
+    const_iterator find(Key const &key) const
+    {
+        Node *node = _find_node(key, _hash_mix<Hash>(m_hash(key)));
+        return node != NULL ? const_iterator{node} : end();
+    }
+
+    bool contains(Key const &key) const
+    {
+        return _find_node(key, _hash_mix<Hash>(m_hash(key))) != NULL;
+    }
+
+    size_t count(Key const &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class K, class... Args>
+    std::pair<iterator, bool> try_emplace(K &&key, Args &&...args)
+    { //* 键不存在时才构造值
+        auto [node, inserted] = _try_emplace_impl(
+            key, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator{node}, inserted};
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args)
+    { //* 先构造出元素才能得到键, 键已存在时再销毁
+        Node *node = _new_node(0, std::forward<Args>(args)...);
+        Key const &key = node->value().m_value.first;
+        size_t h = _hash_mix<Hash>(m_hash(key));
+        if (Node *found = _find_node(key, h))
+        {
+            _delete_node(node);
+            return {iterator{found}, false};
+        }
+        node->value().m_hash = h;
+        if (m_size + 1 > m_bucket_count * (double)m_max_load)
+        {
+            try
+            {
+                _rehash_to(_buckets_for(m_size + 1));
+            }
+            catch (...)
+            {
+                _delete_node(node);
+                throw;
+            }
+        }
+        _link_bucket(node);
+        m_size++;
+        return {iterator{node}, true};
+    }
+
+    std::pair<iterator, bool> insert(value_type const &val)
+    {
+        return try_emplace(val.first, val.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type &&val)
+    {
+        return try_emplace(val.first, std::move(val.second)); //? first 是 Key const, 不能移出, 与 std::unordered_map 一样复制键
+    }
+
+    template <class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <class K, class V>
+    std::pair<iterator, bool> insert_or_assign(K &&key, V &&val)
+    {
+        auto res = try_emplace(std::forward<K>(key), std::forward<V>(val));
+        if (!res.second)
+            res.first->second = std::forward<V>(val);
+        return res;
+    }
+
+    Value &operator[](Key const &key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    Value &operator[](Key &&key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    Value &at(Key const &key)
+    {
+        auto it = find(key);
+        if (it == end()) [[unlikely]]
+            throw std::out_of_range("UnorderedMap::at");
+        return it->second;
+    }
+
+    Value const &at(Key const &key) const
+    {
+        auto it = find(key);
+        if (it == end()) [[unlikely]]
+            throw std::out_of_range("UnorderedMap::at");
+        return it->second;
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    { //* 返回被删元素在链表上的后继
+        Node *node = pos.m_curr;
+        Node *next = node->m_next;
+        _unlink_bucket(node);
+        _delete_node(node);
+        m_size--;
+        return iterator{next};
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        while (first != last)
+            first = erase(first);
+        return iterator{last.m_curr};
+    }
+
+    size_t erase(Key const &key)
+    {
+        Node *node = _find_node(key, _hash_mix<Hash>(m_hash(key)));
+        if (node == NULL)
+            return 0;
+        erase(const_iterator{node});
+        return 1;
+    }
+
+    template <class Pred>
+    size_t erase_if(Pred pred)
+    {
+        size_t old_size = m_size;
+        for (auto it = begin(); it != end();)
+        {
+            if (pred(*it))
+                it = erase(it);
+            else
+                ++it;
+        }
+        return old_size - m_size;
+    }
+
+    void clear() noexcept
+    { //* 释放全部节点, 保留桶数组
+        Node *node = m_dummy.m_next;
+        while (node != &m_dummy)
+        {
+            Node *next = node->m_next;
+            _delete_node(node);
+            node = next;
+        }
+        m_dummy.m_next = m_dummy.m_prev = &m_dummy;
+        if (m_buckets != NULL)
+            std::fill_n(m_buckets, m_bucket_count, (Node *)NULL);
+        m_size = 0;
+    }
+
+    void rehash(size_t count)
+    { //* 桶数至少为 count, 且能以当前负载因子容纳现有元素; 可以缩小
+        size_t need = _buckets_for(m_size);
+        count = std::bit_ceil(count < need ? need : count);
+        if (count != m_bucket_count)
+            _rehash_to(count);
+    }
+
+    void reserve(size_t n)
+    { //* 插入 n 个元素之前不会再 rehash
+        size_t need = _buckets_for(n);
+        if (need > m_bucket_count)
+            _rehash_to(need);
+    }
+
+    float load_factor() const noexcept
+    {
+        return m_bucket_count == 0 ? 0.0f : (float)m_size / m_bucket_count;
+    }
+
+    float max_load_factor() const noexcept
+    {
+        return m_max_load;
+    }
+
+    void max_load_factor(float ml)
+    { //* 调低后立即按需扩容
+        m_max_load = ml;
+        if (m_size > m_bucket_count * (double)m_max_load)
+            _rehash_to(_buckets_for(m_size));
+    }
+
+    size_t bucket_count() const noexcept
+    {
+        return m_bucket_count;
+    }
+
+    size_t bucket(Key const &key) const
+    { //* 仅在 bucket_count() != 0 时有意义
+        return _bucket_of(_hash_mix<Hash>(m_hash(key)));
+    }
+
+    size_t bucket_size(size_t b) const noexcept
+    {
+        size_t n = 0;
+        for (auto it = begin(b); it != end(b); ++it)
+            n++;
+        return n;
+    }
+
+    local_iterator begin(size_t b) noexcept
+    {
+        return local_iterator{m_buckets[b], &m_dummy, b, m_bucket_count - 1};
+    }
+
+    local_iterator end(size_t) noexcept
+    {
+        return local_iterator{NULL, &m_dummy, 0, 0};
+    }
+
+    const_local_iterator begin(size_t b) const noexcept
+    {
+        return const_local_iterator{m_buckets[b], &m_dummy, b, m_bucket_count - 1};
+    }
+
+    const_local_iterator end(size_t) const noexcept
+    {
+        return const_local_iterator{NULL, &m_dummy, 0, 0};
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(m_alloc);
+    }
+
+    bool operator==(UnorderedMap const &that) const
+    {
+        if (m_size != that.m_size)
+            return false;
+        for (auto const &val : *this)
+        {
+            auto it = that.find(val.first);
+            if (it == that.end() || !(it->second == val.second))
+                return false;
+        }
+        return true;
+    }
+};
+
+template <class Key, class Value, class Hash, class KeyEqual, class Alloc, class Pred>
+size_t erase_if(UnorderedMap<Key, Value, Hash, KeyEqual, Alloc> &map, Pred pred)
+{
+    return map.erase_if(pred);
+}
@@ -0,0 +1,618 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <compare>
+#include <algorithm>
+#include <initializer_list>
+#include "vector.hpp"
+
+//?                             展开链表 UnrolledList  目的：每个节点存放一小段连续元素, 减少遍历时的指针跳转
+//?   节点大小约为 ChunkBytes 字节, 节点内元素连续存放, 节点之间与 List 一样双向链接
+//?   在迭代器处插入/删除只移动本节点内的元素, 节点满了分裂、过空时与后继合并, 均摊 O(1)
+//?   与 List 不同: 插入/删除会使同一节点 (以及分裂/合并涉及的节点) 上的迭代器失效
+
+struct UnrolledBaseNode
+{
+    UnrolledBaseNode *m_next;
+    UnrolledBaseNode *m_prev;
+};
+
+template <class T, size_t K>
+struct UnrolledChunkNode : UnrolledBaseNode
+{
+    size_t m_count;
+    union
+    {
+        T m_values[K];
+    };
+};
+
+template <class T, size_t ChunkBytes = 256, class Alloc = std::allocator<T>>
+struct UnrolledList
+{
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T *;
+    using const_pointer = T const *;
+    using reference = T &;
+    using const_reference = T const &;
+
+    //? 每个节点容纳的元素个数: 扣除两个指针和计数后 ChunkBytes 能放下的个数, 至少为 2 以便分裂
+    static constexpr size_t chunk_capacity =
+        ChunkBytes > 3 * sizeof(void *) + 2 * sizeof(T) ? (ChunkBytes - 3 * sizeof(void *)) / sizeof(T) : 2;
+
+private:
+    using BaseNode = UnrolledBaseNode;
+    using ChunkNode = UnrolledChunkNode<T, chunk_capacity>;
+    using AllocNode = std::allocator_traits<Alloc>::template rebind_alloc<ChunkNode>;
+
+    BaseNode m_dummy;
+    size_t m_size;
+    [[no_unique_address]] AllocNode m_alloc;
+
+    static ChunkNode *_chunk(BaseNode *node) noexcept
+    {
+        return static_cast<ChunkNode *>(node);
+    }
+
+    static ChunkNode const *_chunk(BaseNode const *node) noexcept
+    {
+        return static_cast<ChunkNode const *>(node);
+    }
+
+    ChunkNode *_new_chunk_after(BaseNode *prev)
+    { //* 在 prev 之后接入一个空节点
+        ChunkNode *node = m_alloc.allocate(1);
+        node->m_count = 0;
+        BaseNode *next = prev->m_next;
+        node->m_prev = prev;
+        node->m_next = next;
+        prev->m_next = node;
+        next->m_prev = node;
+        return node;
+    }
+
+    void _delete_chunk(ChunkNode *node) noexcept
+    { //* 摘除并释放节点, 调用前节点内元素应已析构
+        node->m_prev->m_next = node->m_next;
+        node->m_next->m_prev = node->m_prev;
+        m_alloc.deallocate(node, 1);
+    }
+
+    static void _shift(T *dst, T *src, size_t n)
+    { //* 在同一节点内把 n 个元素从 src 搬到 dst (两段可重叠), 搬完后 src 中不属于 dst 的位置为未初始化
+        if constexpr (is_trivially_relocatable_v<T>)
+            std::memmove(static_cast<void *>(dst), static_cast<void const *>(src), n * sizeof(T));
+        else if (dst < src)
+        {
+            for (size_t i = 0; i != n; i++)
+            {
+                std::__construct_at(&dst[i], std::move(src[i]));
+                std::destroy_at(&src[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = n; i != 0; i--)
+            {
+                std::__construct_at(&dst[i - 1], std::move(src[i - 1]));
+                std::destroy_at(&src[i - 1]);
+            }
+        }
+    }
+
+    void _relink_dummy(BaseNode *old) noexcept
+    { //* 哨兵嵌在对象内, 交换后首尾节点仍指向原来的哨兵, 需要改指回来
+        if (m_dummy.m_next == old)
+        {
+            m_dummy.m_next = &m_dummy;
+            m_dummy.m_prev = &m_dummy;
+            return;
+        }
+        m_dummy.m_next->m_prev = &m_dummy;
+        m_dummy.m_prev->m_next = &m_dummy;
+    }
+
+    void _init() noexcept
+    {
+        m_dummy.m_next = &m_dummy;
+        m_dummy.m_prev = &m_dummy;
+        m_size = 0;
+    }
+
+public:
+    struct const_iterator;
+
+    struct iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+    private:
+        BaseNode *m_node;
+        size_t m_index;
+
+        friend UnrolledList;
+        friend const_iterator;
+
+        iterator(BaseNode *node, size_t index) : m_node(node), m_index(index) {}
+
+    public:
+        iterator() = default;
+
+        iterator &operator++()
+        {
+            if (++m_index == _chunk(m_node)->m_count)
+            {
+                m_node = m_node->m_next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        iterator &operator--()
+        {
+            if (m_index == 0)
+            {
+                m_node = m_node->m_prev;
+                m_index = _chunk(m_node)->m_count;
+            }
+            --m_index;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T &operator*() const
+        {
+            return _chunk(m_node)->m_values[m_index];
+        }
+
+        T *operator->() const
+        {
+            return &_chunk(m_node)->m_values[m_index];
+        }
+
+        bool operator==(iterator const &that) const
+        {
+            return m_node == that.m_node && m_index == that.m_index;
+        }
+
+        bool operator!=(iterator const &that) const
+        {
+            return !(*this == that);
+        }
+    };
+
+    struct const_iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T const *;
+        using reference = T const &;
+
+    private:
+        BaseNode const *m_node;
+        size_t m_index;
+
+        friend UnrolledList;
+
+        const_iterator(BaseNode const *node, size_t index) : m_node(node), m_index(index) {}
+
+    public:
+        const_iterator() = default;
+
+        const_iterator(iterator that) : m_node(that.m_node), m_index(that.m_index) {}
+
+        const_iterator &operator++()
+        {
+            if (++m_index == _chunk(m_node)->m_count)
+            {
+                m_node = m_node->m_next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        const_iterator &operator--()
+        {
+            if (m_index == 0)
+            {
+                m_node = m_node->m_prev;
+                m_index = _chunk(m_node)->m_count;
+            }
+            --m_index;
+            return *this;
+        }
+
+        const_iterator operator--(int)
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        T const &operator*() const
+        {
+            return _chunk(m_node)->m_values[m_index];
+        }
+
+        T const *operator->() const
+        {
+            return &_chunk(m_node)->m_values[m_index];
+        }
+
+        bool operator==(const_iterator const &that) const
+        {
+            return m_node == that.m_node && m_index == that.m_index;
+        }
+
+        bool operator!=(const_iterator const &that) const
+        {
+            return !(*this == that);
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using reverse_const_iterator = std::reverse_iterator<const_iterator>;
+
+    UnrolledList()
+    {
+        _init();
+    }
+
+    explicit UnrolledList(Alloc const &alloc) noexcept : m_alloc(alloc)
+    {
+        _init();
+    }
+
+    UnrolledList(size_t n, T const &val, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        _init();
+        for (size_t i = 0; i != n; i++)
+            emplace_back(val);
+    }
+
+    template <std::input_iterator InputIt>
+    UnrolledList(InputIt first, InputIt last, Alloc const &alloc = Alloc()) : m_alloc(alloc)
+    {
+        _init();
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    UnrolledList(std::initializer_list<T> ilist, Alloc const &alloc = Alloc())
+        : UnrolledList(ilist.begin(), ilist.end(), alloc) {}
+
+    UnrolledList(UnrolledList const &that)
+        : m_alloc(std::allocator_traits<AllocNode>::select_on_container_copy_construction(that.m_alloc))
+    {
+        _init();
+        for (auto const &val : that)
+            emplace_back(val);
+    }
+
+    UnrolledList(UnrolledList &&that) noexcept : m_alloc(that.m_alloc)
+    {
+        _init();
+        swap(that);
+    }
+
+    UnrolledList &operator=(UnrolledList const &that)
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        for (auto const &val : that)
+            emplace_back(val);
+        return *this;
+    }
+
+    UnrolledList &operator=(UnrolledList &&that) noexcept
+    {
+        if (&that == this) [[unlikely]]
+            return *this;
+        clear();
+        swap(that);
+        return *this;
+    }
+
+    ~UnrolledList()
+    {
+        clear();
+    }
+
+    void swap(UnrolledList &that) noexcept
+    {
+        std::swap(m_dummy, that.m_dummy);
+        std::swap(m_size, that.m_size);
+        std::swap(m_alloc, that.m_alloc);
+        _relink_dummy(&that.m_dummy);
+        that._relink_dummy(&m_dummy);
+    }
+
+    void clear()
+    {
+        BaseNode *curr = m_dummy.m_next;
+        while (curr != &m_dummy)
+        {
+            BaseNode *next = curr->m_next;
+            ChunkNode *node = _chunk(curr);
+            for (size_t i = 0; i != node->m_count; i++)
+                std::destroy_at(&node->m_values[i]);
+            m_alloc.deallocate(node, 1);
+            curr = next;
+        }
+        _init();
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    T &front()
+    {
+        return _chunk(m_dummy.m_next)->m_values[0];
+    }
+
+    T const &front() const
+    {
+        return _chunk(m_dummy.m_next)->m_values[0];
+    }
+
+    T &back()
+    {
+        ChunkNode *node = _chunk(m_dummy.m_prev);
+        return node->m_values[node->m_count - 1];
+    }
+
+    T const &back() const
+    {
+        ChunkNode const *node = _chunk(m_dummy.m_prev);
+        return node->m_values[node->m_count - 1];
+    }
+
+    iterator begin()
+    {
+        return iterator{m_dummy.m_next, 0};
+    }
+
+    iterator end()
+    {
+        return iterator{&m_dummy, 0};
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator{m_dummy.m_next, 0};
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator{&m_dummy, 0};
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    reverse_iterator rbegin()
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    reverse_const_iterator crbegin() const
+    {
+        return std::make_reverse_iterator(cend());
+    }
+
+    reverse_const_iterator crend() const
+    {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args)
+    {
+        BaseNode *last = m_dummy.m_prev;
+        ChunkNode *node = last != &m_dummy && _chunk(last)->m_count != chunk_capacity
+                              ? _chunk(last)
+                              : _new_chunk_after(last);
+        T *p = &node->m_values[node->m_count];
+        try
+        {
+            std::__construct_at(p, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            if (node->m_count == 0)
+                _delete_chunk(node);
+            throw;
+        }
+        node->m_count++;
+        m_size++;
+        return *p;
+    }
+
+    template <class... Args>
+    T &emplace_front(Args &&...args)
+    {
+        return *emplace(cbegin(), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args &&...args)
+    { //* 节点满了先对半分裂, 然后在节点内后移腾出位置
+        BaseNode *base = const_cast<BaseNode *>(pos.m_node);
+        size_t index = pos.m_index;
+        if (base == &m_dummy)
+        { //? 插在末尾: 追加到最后一个节点
+            emplace_back(std::forward<Args>(args)...);
+            base = m_dummy.m_prev;
+            return iterator{base, _chunk(base)->m_count - 1};
+        }
+        T tmp(std::forward<Args>(args)...); //? 参数可能引用本节点中的元素, 先构造出来再移动
+        ChunkNode *node = _chunk(base);
+        if (index == 0 && node->m_prev != &m_dummy && _chunk(node->m_prev)->m_count != chunk_capacity)
+        { //* 插在节点开头且前驱未满时直接追加到前驱末尾, 不移动本节点的元素
+            ChunkNode *prev = _chunk(node->m_prev);
+            std::__construct_at(&prev->m_values[prev->m_count], std::move(tmp));
+            prev->m_count++;
+            m_size++;
+            return iterator{prev, prev->m_count - 1};
+        }
+        if (node->m_count == chunk_capacity)
+        {
+            ChunkNode *next = _new_chunk_after(node);
+            size_t half = chunk_capacity / 2;
+            _shift(next->m_values, node->m_values + half, chunk_capacity - half);
+            next->m_count = chunk_capacity - half;
+            node->m_count = half;
+            if (index > half)
+            {
+                node = next;
+                index -= half;
+            }
+        }
+        _shift(node->m_values + index + 1, node->m_values + index, node->m_count - index);
+        std::__construct_at(&node->m_values[index], std::move(tmp));
+        node->m_count++;
+        m_size++;
+        return iterator{node, index};
+    }
+
+    iterator insert(const_iterator pos, T const &val)
+    {
+        return emplace(pos, val);
+    }
+
+    iterator insert(const_iterator pos, T &&val)
+    {
+        return emplace(pos, std::move(val));
+    }
+
+    void push_back(T const &val)
+    {
+        emplace_back(val);
+    }
+
+    void push_back(T &&val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    void push_front(T const &val)
+    {
+        emplace_front(val);
+    }
+
+    void push_front(T &&val)
+    {
+        emplace_front(std::move(val));
+    }
+
+    iterator erase(const_iterator pos)
+    { //* 节点内前移补位; 节点变空则释放, 不足四分之一时尝试并入后继节点
+        ChunkNode *node = _chunk(const_cast<BaseNode *>(pos.m_node));
+        size_t index = pos.m_index;
+        std::destroy_at(&node->m_values[index]);
+        _shift(node->m_values + index, node->m_values + index + 1, node->m_count - index - 1);
+        node->m_count--;
+        m_size--;
+        BaseNode *next = node->m_next;
+        if (node->m_count == 0)
+        {
+            _delete_chunk(node);
+            return iterator{next, 0};
+        }
+        if (node->m_count < chunk_capacity / 4 && next != &m_dummy &&
+            node->m_count + _chunk(next)->m_count <= chunk_capacity / 2)
+        {
+            ChunkNode *victim = _chunk(next);
+            _shift(node->m_values + node->m_count, victim->m_values, victim->m_count);
+            node->m_count += victim->m_count;
+            _delete_chunk(victim);
+        }
+        if (index == node->m_count)
+            return iterator{node->m_next, 0};
+        return iterator{node, index};
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        //? 逐个删除会改变 last 所在节点的下标, 因此先数出个数
+        size_t n = std::distance(first, last);
+        iterator it{const_cast<BaseNode *>(first.m_node), first.m_index};
+        while (n--)
+            it = erase(it);
+        return it;
+    }
+
+    void pop_front()
+    {
+        erase(cbegin());
+    }
+
+    void pop_back()
+    {
+        erase(std::prev(cend()));
+    }
+
+    bool operator==(UnrolledList const &that) const
+    {
+        if (m_size != that.m_size)
+            return false;
+        return std::equal(cbegin(), cend(), that.cbegin());
+    }
+
+    auto operator<=>(UnrolledList const &that) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), that.cbegin(), that.cend());
+    }
+};
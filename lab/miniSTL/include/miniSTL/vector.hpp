@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <limits>
@@ -8,6 +11,102 @@
 #include <utility>
 #include <compare>
 #include <initializer_list>
+#include <type_traits>
+
+//?                             可平凡重定位 trivially relocatable
+//?   "移动构造到新位置 + 析构旧对象" 等价于按字节拷贝的类型, 搬迁时可直接 memcpy/memmove
+//?   默认对平凡可复制类型成立; 自身不含指向自身指针的类型 (如 Vector) 可特化为 true
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{
+};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+//?                             按位比较 bitwise comparable
+//?   值相等当且仅当对象表示逐字节相等的类型 (整数、枚举、指针), 比较时可直接 memcmp
+//?   浮点数不在此列: +0.0 == -0.0, 而 NaN != NaN
+template <class T>
+inline constexpr bool is_bitwise_comparable_v = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+template <class T>
+size_t _bitwise_mismatch(T const *a, T const *b, size_t n) noexcept
+{ //* 以 64 字节为一块 memcmp (编译器展开为 SIMD 比较), 找到不同的块后再逐个元素定位
+    constexpr size_t block = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+    size_t i = 0;
+    while (i + block <= n && std::memcmp(a + i, b + i, block * sizeof(T)) == 0)
+        i += block;
+    while (i != n && a[i] == b[i])
+        i++;
+    return i;
+}
+
+template <class T>
+bool _range_equal(T *a, T *b, size_t n)
+{ //* T 可以不带 const: 容器把自己的非 const 指针传进来, 元素的 operator== 不必是 const 成员
+    if constexpr (is_bitwise_comparable_v<std::remove_const_t<T>>)
+        return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+            if (!(a[i] == b[i]))
+                return false;
+        return true;
+    }
+}
+
+template <class T>
+auto _range_compare_3way(T const *a, size_t na, T const *b, size_t nb)
+{ //* 字典序三路比较
+    if constexpr (is_bitwise_comparable_v<T>)
+    {
+        size_t n = na < nb ? na : nb;
+        size_t i = _bitwise_mismatch(a, b, n);
+        if (i != n)
+            return a[i] <=> b[i];
+        return na <=> nb;
+    }
+    else
+        return std::lexicographical_compare_three_way(a, a + na, b, b + nb);
+}
+
+//?                             扩容策略 GrowthPolicy  目的：让 push_back 摊还 O(1)
+//?   grow(cap, n) 返回不小于 n 的新容量, cap 为当前容量
+struct GrowthDouble
+{ //* 每次容量 ×2
+    static constexpr size_t default_capacity = 8;
+
+    static size_t grow(size_t cap, size_t n)
+    {
+        size_t new_cap = cap != 0 ? cap * 2 : default_capacity;
+        return new_cap < n ? n : new_cap;
+    }
+};
+
+struct GrowthOneAndHalf
+{ //* 每次容量 ×1.5, 释放的旧块之和有机会被后续分配复用
+    static constexpr size_t default_capacity = 8;
+
+    static size_t grow(size_t cap, size_t n)
+    {
+        size_t new_cap = cap != 0 ? cap + cap / 2 + 1 : default_capacity;
+        return new_cap < n ? n : new_cap;
+    }
+};
+
+template <size_t Chunk = 1024>
+struct GrowthChunk
+{ //* 每次固定增加 Chunk 个元素, 追加仍是 O(n) 摊还, 但内存浪费有上界
+    static_assert(Chunk != 0, "GrowthChunk: Chunk must be positive");
+    static constexpr size_t default_capacity = Chunk;
+
+    static size_t grow(size_t cap, size_t n)
+    {
+        size_t new_cap = cap + Chunk;
+        return new_cap < n ? n : new_cap;
+    }
+};
 
 /*
 ? 定义于头文件 <memory>
@@ -17,11 +116,13 @@
 //?                             分配器 allocator  目的：封装STL容器在内存管理上的低层细节
 //?   T 为存储的对象类型
 //?   Alloc 为使用的分配器, 并默认使用 std::allocator 作为对象的分配器
-template <class T, class Alloc = std::allocator<T>>
+//?   GrowthPolicy 为容量不足时的扩容策略, 默认每次 ×2
+template <class T, class Alloc = std::allocator<T>, class GrowthPolicy = GrowthDouble>
 struct Vector
 {
     using value_type = T;
     using allocator_type = Alloc;
+    using growth_policy = GrowthPolicy;
     using size_type = size_t;
     using difference_type = ptrdiff_t;
     //? ptrdiff_t类型变量通常用来保存两个指针减法操作的结果
@@ -35,6 +136,15 @@ struct Vector
     using reverse_iterator = std::reverse_iterator<T *>;
     using const_reverse_iterator = std::reverse_iterator<T const *>;
 
+    //? data() 首地址保证的对齐字节数: 分配器声明了 alignment (如 AlignedAllocator) 时取其值
+    static constexpr size_t alignment = []
+    {
+        if constexpr (requires { Alloc::alignment; })
+            return Alloc::alignment > alignof(T) ? size_t(Alloc::alignment) : alignof(T);
+        else
+            return alignof(T);
+    }();
+
     T *m_data;
     size_t m_size;
     size_t m_cap;
@@ -48,6 +158,13 @@ struct Vector
         m_cap = 0;
     }
 
+    explicit Vector(Alloc const &alloc) noexcept : m_alloc(alloc)
+    {
+        m_data = NULL;
+        m_size = 0;
+        m_cap = 0;
+    }
+
     Vector(std::initializer_list<T> ilist, Alloc const &alloc = Alloc())
         : Vector(ilist.begin(), ilist.end(), alloc) {} //* 利用初始化列表构造啊
 
@@ -57,8 +174,7 @@ struct Vector
         m_data = m_alloc.allocate(n);
         m_size = n;
         m_cap = n;
-        for (size_t i = 0; i != n; i++)
-            std::__construct_at(&m_data[i]);
+        _uninit_fill(std::assume_aligned<alignment>(m_data), n);
     }
 
     Vector(size_t n, T const &val, Alloc const &alloc = Alloc()) //* 自定义默认值构造
@@ -67,23 +183,17 @@ struct Vector
         m_data = m_alloc.allocate(n);
         m_size = n;
         m_cap = n;
-        for (size_t i = 0; i != n; i++)
-            std::__construct_at(&m_data[i], val);
+        _uninit_fill(std::assume_aligned<alignment>(m_data), n, val);
     }
 
-    template <std::random_access_iterator InputIt>
+    template <std::input_iterator InputIt>
     Vector(InputIt first, InputIt last, Alloc const &alloc = Alloc()) //* 读取input区构造
         : m_alloc(alloc)
     {
-        size_t n = last - first;
-        m_data = m_alloc.allocate(n);
-        m_size = n;
-        m_cap = n;
-        for (size_t i = 0; i != n; i++)
-        {
-            std::__construct_at(&m_data[i], *first);
-            first++;
-        }
+        m_data = NULL;
+        m_size = 0;
+        m_cap = 0;
+        _append(first, last);
     }
 
     void clear()
@@ -101,28 +211,61 @@ struct Vector
         else if (n > m_size)
         {
             reserve(n);
-            for (size_t i = m_size; i != n; i++)
-                std::__construct_at(&m_data[i]);
+            _uninit_fill(m_data + m_size, n - m_size);
         }
         m_size = n;
     }
 
     void resize(size_t n, T const &val) //*带值重构
     {
+        if (n < m_size)
+            for (size_t i = n; i != m_size; i++)
+                std::destroy_at(&m_data[i]);
+        else if (n > m_size)
+        {
+            if (n > m_cap)
+            { //? val 可能引用自身元素, 扩容前先复制一份
+                T tmp(val);
+                reserve(n);
+                _uninit_fill(m_data + m_size, n - m_size, tmp);
+            }
+            else
+                _uninit_fill(m_data + m_size, n - m_size, val);
+        }
+        m_size = n;
+    }
+
+    void resize_for_overwrite(size_t n)
+    { //* 新增元素只做默认初始化, 平凡类型不清零, 适合随后立刻整体写入 (如读文件) 的缓冲区
         if (n < m_size)
             for (size_t i = n; i != m_size; i++)
                 std::destroy_at(&m_data[i]);
         else if (n > m_size)
         {
             reserve(n);
-            for (size_t i = m_size; i != n; i++)
-                std::__construct_at(&m_data[i], val);
+            if constexpr (!std::is_trivially_default_constructible_v<T>)
+                for (size_t i = m_size; i != n; i++)
+                    ::new (static_cast<void *>(&m_data[i])) T;
         }
         m_size = n;
     }
 
+    //? 分配器提供 reallocate (如 MmapAllocator) 且元素可按字节搬迁时, 扩容/收缩交给分配器原地完成
+    static constexpr bool _can_reallocate = is_trivially_relocatable_v<T> &&
+                                            requires(Alloc &alloc, T *p, size_t n) { alloc.reallocate(p, n, n); };
+
     void shrink_to_fit()
     {
+        if constexpr (_can_reallocate)
+        {
+            if (m_size != 0 && m_cap != 0)
+            {
+                if (m_size != m_cap)
+                    m_data = m_alloc.reallocate(m_data, m_cap, m_size);
+                m_cap = m_size;
+                return;
+            }
+        }
         auto old_data = m_data;
         auto old_cap = m_cap;
         m_cap = m_size;
@@ -132,12 +275,7 @@ struct Vector
             m_data = m_alloc.allocate(m_size);
         if (old_cap != 0) [[likely]]
         { //? ‌向编译器提供关于代码分支执行概率的提示，帮助编译器进行更好的优化。
-            for (size_t i = 0; i != m_size; i++)
-            {
-                std::__construct_at(&m_data[i], std::move_if_noexcept(old_data[i]));
-                //?                               若移动构造函数不抛出异常则获得右值引用
-                std::destroy_at(&old_data[i]);
-            }
+            _relocate(m_data, old_data, m_size);
             m_alloc.deallocate(old_data, old_cap);
             //?  释放之前通过 allocate 方法分配的内存
         }
@@ -147,6 +285,15 @@ struct Vector
     { //? 与realloc类似  可以一次性分配指定大小的内存
         if (n <= m_cap)
             return;
+        if constexpr (_can_reallocate)
+        {
+            if (m_cap != 0)
+            {
+                m_data = m_alloc.reallocate(m_data, m_cap, n);
+                m_cap = n;
+                return;
+            }
+        }
         auto old_data = m_data;
         auto old_cap = m_cap;
         if (n == 0)
@@ -161,14 +308,76 @@ struct Vector
         }
         if (old_cap != 0)
         {
-            for (size_t i = 0; i != m_size; i++)
-                std::__construct_at(&m_data[i], std::move_if_noexcept(old_data[i]));
-            for (size_t i = 0; i != m_size; i++)
-                std::destroy_at(&old_data[i]);
+            _relocate(m_data, old_data, m_size);
             m_alloc.deallocate(old_data, old_cap);
         }
     }
 
+    static void _uninit_fill(T *p, size_t n)
+    { //* 值初始化 n 个元素, 平凡类型的值初始化即全零, 直接 memset
+        if constexpr (std::is_trivial_v<T>)
+        {
+            if (n != 0)
+                std::memset(static_cast<void *>(p), 0, n * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i != n; i++)
+                std::__construct_at(&p[i]);
+        }
+    }
+
+    static void _uninit_fill(T *p, size_t n, T const &val)
+    { //* 以 val 拷贝构造 n 个元素, 平凡可复制类型走 memset / 可向量化的 fill_n
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            T const tmp = val;
+            if constexpr (sizeof(T) == 1)
+                std::memset(static_cast<void *>(p), *reinterpret_cast<unsigned char const *>(&tmp), n);
+            else
+                std::fill_n(p, n, tmp);
+        }
+        else
+        {
+            for (size_t i = 0; i != n; i++)
+                std::__construct_at(&p[i], val);
+        }
+    }
+
+    static void _relocate(T *dst, T *src, size_t n)
+    { //* 把 src 处的 n 个元素搬到未初始化的 dst, 搬完后 src 处不再有存活对象
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            if (n != 0)
+                std::memcpy(static_cast<void *>(dst), static_cast<void const *>(src), n * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i != n; i++)
+                std::__construct_at(&dst[i], std::move_if_noexcept(src[i]));
+            //?                          若移动构造函数不抛出异常则获得右值引用
+            for (size_t i = 0; i != n; i++)
+                std::destroy_at(&src[i]);
+        }
+    }
+
+    void _open_gap(size_t j, size_t n)
+    { //* 把 [j, m_size) 后移 n 位, 空出未初始化的 [j, j + n), 调用前需保证容量足够
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void *>(m_data + j + n), static_cast<void const *>(m_data + j),
+                         (m_size - j) * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = m_size; i != j; i--)
+            {
+                std::__construct_at(&m_data[i + n - 1], std::move(m_data[i - 1]));
+                std::destroy_at(&m_data[i - 1]);
+            }
+        }
+    }
+
     size_t capacity() const
     {
         return m_cap;
@@ -230,7 +439,7 @@ struct Vector
         that.m_cap = 0;
     }
 
-    Vector &operator=(Vector &&that) const
+    Vector &operator=(Vector &&that)
     {
         if (&that == this) [[unlikely]]
             return *this;
@@ -257,7 +466,7 @@ struct Vector
     }
 
     Vector(Vector const &that)
-        : m_alloc(that.m_alloc)
+        : m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(that.m_alloc))
     {
         m_size = that.m_size;
         m_cap = that.m_size;
@@ -316,30 +525,88 @@ struct Vector
         return m_data[m_size - 1];
     }
 
-    void push_back(T const &val)
+    template <class... Args>
+    T *_emplace_realloc(size_t j, Args &&...args)
+    { //* 容量不足时: 先在新缓冲区的 j 处构造新元素, 再搬迁旧元素
+        //? 参数可能引用旧缓冲区中的元素 (如 v.emplace_back(v[0])), 必须在搬迁之前使用
+        size_t new_cap = GrowthPolicy::grow(m_cap, m_size + 1);
+        if constexpr (_can_reallocate)
+        { //? 原地重映射后旧地址失效, 只能先构造临时对象
+            T tmp(std::forward<Args>(args)...);
+            reserve(new_cap);
+            _open_gap(j, 1);
+            std::__construct_at(&m_data[j], std::move(tmp));
+            m_size++;
+            return m_data + j;
+        }
+        T *new_data = m_alloc.allocate(new_cap);
+        try
+        {
+            std::__construct_at(&new_data[j], std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_alloc.deallocate(new_data, new_cap);
+            throw;
+        }
+        _relocate(new_data, m_data, j);
+        _relocate(new_data + j + 1, m_data + j, m_size - j);
+        if (m_cap != 0)
+            m_alloc.deallocate(m_data, m_cap);
+        m_data = new_data;
+        m_cap = new_cap;
+        m_size++;
+        return m_data + j;
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args)
     {
-        if (m_size + 1 >= m_cap) [[unlikely]]
-            reserve(m_size + 1);
-        std::__construct_at(&m_data[m_size], val);
+        if (m_size == m_cap) [[unlikely]]
+            return *_emplace_realloc(m_size, std::forward<Args>(args)...);
+        std::__construct_at(&m_data[m_size], std::forward<Args>(args)...);
         m_size = m_size + 1;
+        return m_data[m_size - 1];
+    }
+
+    template <class... Args>
+    T *emplace(T const *it, Args &&...args)
+    {
+        size_t j = it - m_data;
+        if (m_size == m_cap) [[unlikely]]
+            return _emplace_realloc(j, std::forward<Args>(args)...);
+        if (j == m_size)
+        {
+            std::__construct_at(&m_data[m_size], std::forward<Args>(args)...);
+            m_size++;
+            return m_data + j;
+        }
+        //? 原地后移会改写参数可能引用的元素, 这里只能先构造出临时对象再移入空位
+        T tmp(std::forward<Args>(args)...);
+        _open_gap(j, 1);
+        m_size++;
+        std::__construct_at(&m_data[j], std::move(tmp));
+        return m_data + j;
+    }
+
+    void push_back(T const &val)
+    {
+        emplace_back(val);
     }
 
     void push_back(T &&val)
     {
-        if (m_size + 1 >= m_cap) [[unlikely]]
-            reserve(m_size + 1);
-        std::__construct_at(&m_data[m_size], std::move(val));
-        m_size = m_size + 1;
+        emplace_back(std::move(val));
     }
 
     T *data()
-    {
-        return m_data;
+    { //* 告知编译器首地址的对齐, 调用方的循环可以直接使用对齐加载
+        return std::assume_aligned<alignment>(m_data);
     }
 
     T const *data() const
     {
-        return m_data;
+        return std::assume_aligned<alignment>(m_data);
     }
 
     T const *cdata() const
@@ -403,47 +670,113 @@ struct Vector
         std::destroy_at(&m_data[m_size]);
     }
 
+    template <class Pred>
+    size_t remove_if(Pred pred)
+    { //* 单趟压实: 保留的元素依次前移一次, 最后统一析构尾部, 返回删除的个数
+        size_t i = 0;
+        while (i != m_size && !pred(std::as_const(m_data[i])))
+            i++;
+        size_t j = i;
+        for (; i != m_size; i++)
+            if (!pred(std::as_const(m_data[i])))
+            {
+                m_data[j] = std::move(m_data[i]);
+                j++;
+            }
+        size_t count = m_size - j;
+        for (i = j; i != m_size; i++)
+            std::destroy_at(&m_data[i]);
+        m_size = j;
+        return count;
+    }
+
+    size_t remove(T const &val)
+    {
+        T tmp(val); //? val 可能引用自身元素, 压实过程中会被覆盖
+        return remove_if([&](T const &x) { return x == tmp; });
+    }
+
+    template <class BinaryPred = std::equal_to<>>
+    size_t unique(BinaryPred pred = BinaryPred())
+    { //* 删除相邻的重复元素, 只保留每段中的第一个
+        if (m_size == 0)
+            return 0;
+        size_t j = 1;
+        for (size_t i = 1; i != m_size; i++)
+            if (!pred(std::as_const(m_data[j - 1]), std::as_const(m_data[i])))
+            {
+                if (i != j)
+                    m_data[j] = std::move(m_data[i]);
+                j++;
+            }
+        size_t count = m_size - j;
+        for (size_t i = j; i != m_size; i++)
+            std::destroy_at(&m_data[i]);
+        m_size = j;
+        return count;
+    }
+
     T *erase(T const *it) noexcept(std::is_nothrow_move_assignable_v<T>)
     {
-        size_t i = it - m_data;
-        for (size_t j = i + 1; j != m_size; j++)
-            m_data[j - 1] = std::move(m_data[j]);
-        m_size--;
-        std::destroy_at(&m_data[m_size]);
-        return const_cast<T *>(it);
+        return erase(it, it + 1);
     }
 
     T *erase(T const *first, T const *last) noexcept(std::is_nothrow_move_assignable_v<T>)
     {
         size_t diff = last - first;
-        for (size_t j = last - m_data; j != m_size; j++)
-            m_data[j - diff] = std::move(m_data[j]);
-        m_size -= diff;
-        for (size_t j = m_size; j != m_size + diff; j++)
-            std::destroy_at(&m_data[j]);
+        if constexpr (is_trivially_relocatable_v<T>)
+        { //* 先析构被删除的元素, 再把尾部整体 memmove 下来
+            size_t i = first - m_data;
+            for (size_t j = i; j != i + diff; j++)
+                std::destroy_at(&m_data[j]);
+            std::memmove(static_cast<void *>(m_data + i), static_cast<void const *>(last),
+                         (m_size - i - diff) * sizeof(T));
+            m_size -= diff;
+        }
+        else
+        {
+            for (size_t j = last - m_data; j != m_size; j++)
+                m_data[j - diff] = std::move(m_data[j]);
+            m_size -= diff;
+            for (size_t j = m_size; j != m_size + diff; j++)
+                std::destroy_at(&m_data[j]);
+        }
         return const_cast<T *>(first);
     }
 
     void assign(size_t n, T const &val)
     {
+        T tmp(val); //? val 可能引用自身元素, clear 之前先复制一份
         clear();
         reserve(n);
+        _uninit_fill(m_data, n, tmp);
         m_size = n;
-        for (size_t i = 0; i != n; i++)
-            std::__construct_at(&m_data[i], val);
     }
 
-    template <std::random_access_iterator InputIt>
+    template <std::input_iterator InputIt>
     void assign(InputIt first, InputIt last)
     {
         clear();
-        size_t n = last - first;
-        reserve(n);
-        m_size = n;
-        for (size_t i = 0; i != n; i++)
+        _append(first, last);
+    }
+
+    template <std::input_iterator InputIt>
+    void _append(InputIt first, InputIt last)
+    { //* 追加到末尾: 前向迭代器先求长度, 只分配一次且容量恰好; 输入迭代器只能逐个追加
+        if constexpr (std::forward_iterator<InputIt>)
         {
-            std::__construct_at(m_data[i], *first);
-            first++;
+            size_t n = std::distance(first, last);
+            reserve(m_size + n);
+            for (; first != last; ++first)
+            {
+                std::__construct_at(&m_data[m_size], *first);
+                m_size++;
+            }
+        }
+        else
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
         }
     }
 
@@ -455,58 +788,90 @@ struct Vector
     Vector &operator=(std::initializer_list<T> ilist)
     {
         assign(ilist.begin(), ilist.end());
+        return *this;
     }
 
     T *insert(T const *it, T &&val)
     {
-        size_t j = it - m_data;
-        reserve(m_size + 1);
-        for (size_t i = m_size; i != j; i--)
-        {
-            std::__construct_at(&m_data[i], std::move(m_data[i - 1]));
-            std::destroy_at(&m_data[i - 1]);
-        }
-        m_size++;
-        std::__construct_at(&m_data[j], std::move(val));
-        return m_data + j;
+        return emplace(it, std::move(val));
     }
 
     T *insert(T const *it, T const &val)
     {
-        size_t j = it - m_data;
-        reserve(m_size + 1);
-        for (size_t i = m_size; i != j; i--)
+        return emplace(it, val);
+    }
+
+    template <class Construct>
+    T *_insert_n(size_t j, size_t n, Construct construct)
+    { //* 在 j 处插入 n 个元素, construct(p, n) 负责在未初始化的 p 处构造它们
+        //? 至多一次重新分配、一次尾部搬移: 容量不足时直接在新缓冲区里构造新元素, 再把前后两段搬过去
+        if (n == 0) [[unlikely]]
+            return m_data + j;
+        if (m_size + n > m_cap)
+        {
+            size_t new_cap = GrowthPolicy::grow(m_cap, m_size + n);
+            T *new_data = m_alloc.allocate(new_cap);
+            try
+            {
+                construct(new_data + j, n);
+            }
+            catch (...)
+            {
+                m_alloc.deallocate(new_data, new_cap);
+                throw;
+            }
+            _relocate(new_data, m_data, j);
+            _relocate(new_data + j + n, m_data + j, m_size - j);
+            if (m_cap != 0)
+                m_alloc.deallocate(m_data, m_cap);
+            m_data = new_data;
+            m_cap = new_cap;
+        }
+        else
         {
-            std::__construct_at(&m_data[i], std::move(m_data[i - 1]));
-            std::destroy_at(&m_data[i - 1]);
+            _open_gap(j, n);
+            construct(m_data + j, n);
         }
-        m_size++;
-        std::__construct_at(&m_data[j], val);
+        m_size += n;
         return m_data + j;
     }
 
-    T *insert(T const *it, size_t n, T const &val);
+    T *insert(T const *it, size_t n, T const &val)
+    {
+        size_t j = it - m_data;
+        if (n != 0 && m_size + n <= m_cap && &val >= m_data + j && &val < m_data + m_size)
+        { //? val 引用的元素会被原地后移, 先复制一份
+            T tmp(val);
+            return _insert_n(j, n, [&](T *p, size_t n) { _uninit_fill(p, n, tmp); });
+        }
+        return _insert_n(j, n, [&](T *p, size_t n) { _uninit_fill(p, n, val); });
+    }
 
-    template <std::random_access_iterator InputIt>
+    template <std::input_iterator InputIt>
     T *insert(T const *it, InputIt first, InputIt last)
     {
         size_t j = it - m_data;
-        size_t n = last - first;
-        if (n == 0) [[unlikely]]
-            return const_cast<T *>(it);
-        reserve(m_size + n);
-        for (size_t i = m_size; i != j; i--)
-        {
-            std::__construct_at(&m_data[i + n - 1], std::move(m_data[i - 1]));
-            std::destroy_at(&m_data[i - 1]);
+        if constexpr (std::forward_iterator<InputIt>)
+        { //* 前向迭代器: 先求出长度, 再一次性腾出位置
+            size_t n = std::distance(first, last);
+            auto construct = [&](T *p, size_t n)
+            {
+                for (size_t i = 0; i != n; i++, ++first)
+                    std::__construct_at(&p[i], *first);
+            };
+            return _insert_n(j, n, construct);
         }
-        m_size += n;
-        for (size_t i = j; i != j + n; i++)
-        {
-            std::__construct_at(&m_data[i], *first);
-            first++;
+        else
+        { //* 输入迭代器只能遍历一次: 先缓存到临时 Vector, 再整体移入
+            Vector buf(m_alloc);
+            buf._append(first, last);
+            auto construct = [&](T *p, size_t n)
+            {
+                for (size_t i = 0; i != n; i++)
+                    std::__construct_at(&p[i], std::move(buf.m_data[i]));
+            };
+            return _insert_n(j, buf.m_size, construct);
         }
-        return m_data + j;
     }
 
     T *insert(T const *it, std::initializer_list<T> ilist)
@@ -526,9 +891,30 @@ struct Vector
     {
         if (m_size != that.m_size)
             return false;
-        for (size_t i = 0; i < m_size; ++i)
-            if (!(m_data[i] == that.m_data[i]))
-                return false;
-        return true;
+        return _range_equal(m_data, that.m_data, m_size);
+    }
+
+    auto operator<=>(Vector const &that) const
+    {
+        return _range_compare_3way(data(), m_size, that.data(), that.m_size);
     }
 };
+
+template <class T, class Alloc, class GrowthPolicy, class Pred>
+size_t erase_if(Vector<T, Alloc, GrowthPolicy> &vec, Pred pred)
+{
+    return vec.remove_if(pred);
+}
+
+template <class T, class Alloc, class GrowthPolicy>
+size_t erase(Vector<T, Alloc, GrowthPolicy> &vec, T const &val)
+{
+    return vec.remove(val);
+}
+
+//? Vector 只持有指向堆内存的指针, 分配器无状态或可平凡重定位时整体可按字节搬迁
+template <class T, class Alloc, class GrowthPolicy>
+struct is_trivially_relocatable<Vector<T, Alloc, GrowthPolicy>>
+    : std::bool_constant<std::is_empty_v<Alloc> || is_trivially_relocatable_v<Alloc>>
+{
+};
@@ -0,0 +1,87 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <random>
+#include <iterator>
+
+TEST_CASE("test arena list", "[arena_list]") {
+
+    SECTION("test iterators stay valid across arena growth") {
+        ArenaList<int> lst;
+        lst.push_back(1);
+        auto first = lst.begin();
+        auto last = std::prev(lst.end());
+        for (int i = 2; i <= 1000; i++)
+            lst.push_back(i);
+        lst.push_front(0);
+        REQUIRE(lst.capacity() >= 1001);
+        REQUIRE(*first == 1);
+        REQUIRE(*last == 1);
+        REQUIRE(*std::next(first) == 2);
+        REQUIRE(*std::prev(first) == 0);
+        REQUIRE(lst.size() == 1001);
+        REQUIRE(lst.front() == 0);
+        REQUIRE(lst.back() == 1000);
+        int expect = 1000;
+        for (auto it = lst.rbegin(); it != lst.rend(); ++it)
+            REQUIRE(*it == expect--);
+    }
+
+    SECTION("test erased slots are reused and match std::list") {
+        ArenaList<std::string> lst;
+        std::list<std::string> ref;
+        std::mt19937 rng(11);
+        for (int i = 0; i < 3000; i++)
+        {
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            auto it = std::next(lst.begin(), pos);
+            auto rit = std::next(ref.begin(), pos);
+            if (ref.empty() || rng() % 2)
+            {
+                lst.insert(it, std::to_string(i));
+                ref.insert(rit, std::to_string(i));
+            }
+            else if (rit != ref.end())
+            {
+                auto ret = lst.erase(it);
+                auto rret = ref.erase(rit);
+                REQUIRE((ret == lst.end()) == (rret == ref.end()));
+            }
+        }
+        REQUIRE(lst.size() == ref.size());
+        REQUIRE(std::equal(lst.begin(), lst.end(), ref.begin(), ref.end()));
+
+        size_t cap = lst.capacity();
+        size_t n = lst.size();
+        lst.erase(lst.begin(), std::next(lst.begin(), n / 2));
+        for (size_t i = 0; i < n / 2; i++)
+            lst.emplace_front(lst.back());
+        REQUIRE(lst.size() == n);
+        REQUIRE(lst.capacity() == cap);
+    }
+
+    SECTION("test copy move and compare") {
+        ArenaList<int> a({1, 2, 3, 4});
+        a.pop_front();
+        a.push_back(5);
+        ArenaList<int> b(a);
+        REQUIRE(b == a);
+        REQUIRE(std::vector<int>(b.begin(), b.end()) == std::vector<int>{2, 3, 4, 5});
+        b.back() = 6;
+        REQUIRE(b > a);
+        ArenaList<int> c(std::move(b));
+        REQUIRE(b.empty());
+        REQUIRE(b.begin() == b.end());
+        b = c;
+        REQUIRE(b == c);
+        c.clear();
+        REQUIRE(c.empty());
+        c.swap(b);
+        REQUIRE(c.back() == 6);
+        STATIC_REQUIRE(std::is_trivially_copyable_v<ArenaNode<int>>);
+        STATIC_REQUIRE(is_trivially_relocatable_v<ArenaList<int>>);
+        STATIC_REQUIRE(sizeof(ArenaNode<int>) == 12);
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <functional>
+
+TEST_CASE("test blocked bloom filter", "[bloom_filter]") {
+
+    SECTION("test no false negatives") {
+        BlockedBloomFilter<uint64_t> filter(10000);
+        for (uint64_t i = 0; i != 10000; i++)
+            filter.insert(i * 7919);
+        for (uint64_t i = 0; i != 10000; i++)
+            REQUIRE(filter.contains(i * 7919));
+        REQUIRE(filter.inserted() == 10000);
+        REQUIRE(filter.memory_bytes() == filter.block_count() * 64);
+        REQUIRE(filter.memory_bytes() * 8 >= 10000 * 10);
+    }
+
+    SECTION("test false positive rate") {
+        //? 每键 10 位时理论约 1%, 分块后略高
+        BlockedBloomFilter<uint64_t> filter(100000, 10);
+        for (uint64_t i = 0; i != 100000; i++)
+            filter.insert(i);
+        size_t false_positives = 0;
+        for (uint64_t i = 100000; i != 300000; i++)
+            false_positives += filter.contains(i);
+        REQUIRE(false_positives < 200000 * 0.02);
+
+        BlockedBloomFilter<uint64_t> loose(100000, 4);
+        size_t loose_positives = 0;
+        for (uint64_t i = 0; i != 100000; i++)
+            loose.insert(i);
+        for (uint64_t i = 100000; i != 300000; i++)
+            loose_positives += loose.contains(i);
+        REQUIRE(loose_positives > false_positives);
+    }
+
+    SECTION("test identity std::hash") {
+        //? std::hash<uint64_t> 对整数为恒等映射, 过滤器需自行混合后再选块和置位
+        BlockedBloomFilter<uint64_t, std::hash<uint64_t>> filter(100000, 10);
+        for (uint64_t i = 0; i != 100000; i++)
+            filter.insert(i);
+        for (uint64_t i = 0; i != 100000; i++)
+            REQUIRE(filter.contains(i));
+        size_t false_positives = 0;
+        for (uint64_t i = 100000; i != 300000; i++)
+            false_positives += filter.contains(i);
+        REQUIRE(false_positives < 200000 * 0.02);
+    }
+
+    SECTION("test bulk operations match single queries") {
+        BlockedBloomFilter<uint64_t, Hasher<uint64_t>, PoolAllocator<uint64_t>> filter(5000, 8);
+        Vector<uint64_t> keys;
+        for (uint64_t i = 0; i != 5000; i++)
+            keys.push_back(i * i + 1);
+        filter.insert_bulk(keys);
+        REQUIRE(filter.inserted() == 5000);
+
+        Vector<uint64_t> queries;
+        for (uint64_t i = 0; i != 20003; i++)
+            queries.push_back(i);
+        Vector<uint8_t> out;
+        size_t found = filter.contains_bulk(queries, out);
+        REQUIRE(out.size() == queries.size());
+        size_t expected = 0;
+        for (size_t i = 0; i != queries.size(); i++)
+        {
+            REQUIRE(bool(out[i]) == filter.contains(queries[i]));
+            expected += out[i];
+        }
+        REQUIRE(found == expected);
+        REQUIRE(filter.contains_bulk(keys, out) == keys.size());
+    }
+
+    SECTION("test string keys, clear and swap") {
+        BlockedBloomFilter<std::string> a(100), b(1000);
+        a.insert("apple");
+        a.insert("banana");
+        REQUIRE(a.contains("apple"));
+        REQUIRE(a.contains(std::string("banana")));
+        a.swap(b);
+        REQUIRE(b.contains("apple"));
+        REQUIRE(a.inserted() == 0);
+        REQUIRE(a.block_count() > b.block_count());
+        b.clear();
+        REQUIRE_FALSE(b.contains("apple"));
+        REQUIRE(b.inserted() == 0);
+    }
+}
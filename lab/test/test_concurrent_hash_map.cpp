@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+TEST_CASE("test concurrent hash map", "[concurrent_hash_map]") {
+
+    SECTION("test single thread operations") {
+        ConcurrentHashMap<int, int, std::hash<int>, std::equal_to<int>, 4> m;
+        STATIC_REQUIRE(decltype(m)::lock_free_reads);
+        REQUIRE(m.empty());
+        REQUIRE_FALSE(m.find(1).has_value());
+        for (int i = 0; i < 1000; i++)
+            REQUIRE(m.insert_or_assign(i, i * 2));
+        REQUIRE(m.size() == 1000);
+        REQUIRE_FALSE(m.insert_or_assign(7, -7));
+        REQUIRE(*m.find(7) == -7);
+        REQUIRE(*m.find(999) == 1998);
+        REQUIRE_FALSE(m.contains(1000));
+        for (int i = 0; i < 1000; i += 2)
+            REQUIRE(m.erase(i));
+        REQUIRE_FALSE(m.erase(0));
+        REQUIRE(m.size() == 500);
+        for (int i = 0; i < 1000; i++)
+            REQUIRE(m.contains(i) == (i % 2 == 1));
+        long long sum = 0;
+        m.for_each([&](int const &k, int const &) { sum += k; });
+        REQUIRE(sum == 250000);
+        m.reclaim();
+        m.clear();
+        REQUIRE(m.empty());
+        REQUIRE_FALSE(m.contains(1));
+    }
+
+    SECTION("test non-trivial types use shared lock reads") {
+        ConcurrentHashMap<std::string, std::string> m(100);
+        STATIC_REQUIRE_FALSE(decltype(m)::lock_free_reads);
+        for (int i = 0; i < 300; i++)
+            m.insert_or_assign(std::to_string(i), std::string(20, 'a' + i % 26));
+        REQUIRE(m.size() == 300);
+        REQUIRE(*m.find("27") == std::string(20, 'b'));
+        REQUIRE(m.erase("27"));
+        REQUIRE_FALSE(m.find("27").has_value());
+        REQUIRE(m.find("28").value() == std::string(20, 'c'));
+    }
+
+    SECTION("test concurrent readers and writers") {
+        //? 偶数键只读, 奇数键被各写线程反复插入删除; 读者必须总能看到偶数键的正确值
+        constexpr int keys = 4096;
+        constexpr int writers = 4;
+        constexpr int readers = 4;
+        ConcurrentHashMap<long long, long long, std::hash<long long>, std::equal_to<long long>, 8> m;
+        for (long long k = 0; k < keys; k += 2)
+            m.insert_or_assign(k, k * 3);
+
+        std::atomic<bool> ok{true};
+        std::vector<std::thread> threads;
+        for (int w = 0; w < writers; w++)
+            threads.emplace_back([&, w] {
+                for (int round = 0; round < 4; round++)
+                    for (long long k = 1 + 2 * w; k < keys * 4; k += 2 * writers)
+                    {
+                        m.insert_or_assign(k, k * 3);
+                        if (round % 2 == 1)
+                            m.erase(k);
+                    }
+            });
+        for (int r = 0; r < readers; r++)
+            threads.emplace_back([&] {
+                for (int round = 0; round < 20; round++)
+                    for (long long k = 0; k < keys; k++)
+                    {
+                        auto val = m.find(k);
+                        if (k % 2 == 0 && val != std::optional<long long>(k * 3))
+                            ok = false;
+                        if (val.has_value() && *val != k * 3)
+                            ok = false;
+                    }
+            });
+        for (auto &t : threads)
+            t.join();
+        REQUIRE(ok);
+        REQUIRE(m.size() == keys / 2);
+        size_t visited = 0;
+        m.for_each([&](long long const &k, long long const &v) { visited += (k % 2 == 0 && v == k * 3); });
+        REQUIRE(visited == keys / 2);
+    }
+}
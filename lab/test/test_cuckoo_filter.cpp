@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <functional>
+
+TEST_CASE("test cuckoo filter", "[cuckoo_filter]") {
+
+    SECTION("test insert, contains and erase") {
+        CuckooFilter<uint64_t> filter(10000);
+        REQUIRE(filter.capacity() >= 10000);
+        for (uint64_t i = 0; i != 10000; i++)
+            REQUIRE(filter.insert(i * 7919));
+        REQUIRE(filter.size() == 10000);
+        for (uint64_t i = 0; i != 10000; i++)
+            REQUIRE(filter.contains(i * 7919));
+        for (uint64_t i = 0; i != 10000; i += 2)
+            REQUIRE(filter.erase(i * 7919));
+        REQUIRE(filter.size() == 5000);
+        for (uint64_t i = 1; i < 10000; i += 2)
+            REQUIRE(filter.contains(i * 7919));
+        size_t remaining = 0;
+        for (uint64_t i = 0; i < 10000; i += 2)
+            remaining += filter.contains(i * 7919);
+        REQUIRE(remaining < 50); //? 删除后只剩误判
+        REQUIRE_FALSE(filter.erase(1));
+    }
+
+    SECTION("test duplicates are counted") {
+        CuckooFilter<std::string> filter(100);
+        REQUIRE(filter.insert("key"));
+        REQUIRE(filter.insert("key"));
+        REQUIRE(filter.erase("key"));
+        REQUIRE(filter.contains("key"));
+        REQUIRE(filter.erase("key"));
+        REQUIRE_FALSE(filter.contains("key"));
+        REQUIRE(filter.size() == 0);
+    }
+
+    SECTION("test false positive rate") {
+        CuckooFilter<uint64_t> filter(100000);
+        for (uint64_t i = 0; i != 100000; i++)
+            filter.insert(i);
+        size_t false_positives = 0;
+        for (uint64_t i = 100000; i != 1100000; i++)
+            false_positives += filter.contains(i);
+        REQUIRE(false_positives < 1000000 * 0.0005);
+    }
+
+    SECTION("test identity std::hash") {
+        //? std::hash<uint64_t> 对整数为恒等映射, 过滤器需自行混合后再取指纹和桶号
+        CuckooFilter<uint64_t, std::hash<uint64_t>> filter(100000);
+        for (uint64_t i = 0; i != 100000; i++)
+            REQUIRE(filter.insert(i));
+        for (uint64_t i = 0; i != 100000; i++)
+            REQUIRE(filter.contains(i));
+        size_t false_positives = 0;
+        for (uint64_t i = 100000; i != 1100000; i++)
+            false_positives += filter.contains(i);
+        REQUIRE(false_positives < 1000000 * 0.0005);
+    }
+
+    SECTION("test filling until full") {
+        CuckooFilter<uint64_t> filter(1000);
+        uint64_t n = 0;
+        while (filter.insert(n))
+            n++;
+        REQUIRE(filter.size() == n); //? 最后一次成功插入的指纹被暂存, 之后的插入失败
+        REQUIRE(filter.load_factor() > 0.9);
+        REQUIRE_FALSE(filter.insert(n + 1));
+        for (uint64_t i = 0; i != n; i++)
+            REQUIRE(filter.contains(i));
+        for (uint64_t i = 0; i != 50; i++)
+            REQUIRE(filter.erase(i));
+        REQUIRE(filter.insert(n + 1)); //? 删除后暂存的指纹放回表中, 又能插入
+        for (uint64_t i = 50; i != n; i++)
+            REQUIRE(filter.contains(i));
+        REQUIRE(filter.contains(n + 1));
+        filter.clear();
+        REQUIRE(filter.size() == 0);
+        REQUIRE(filter.insert(0));
+    }
+
+    SECTION("test bulk operations match single queries") {
+        CuckooFilter<uint64_t, Hasher<uint64_t>, PoolAllocator<uint64_t>> filter(5000);
+        Vector<uint64_t> keys;
+        for (uint64_t i = 0; i != 5000; i++)
+            keys.push_back(i * i + 1);
+        REQUIRE(filter.insert_bulk(keys) == 5000);
+
+        Vector<uint64_t> queries;
+        for (uint64_t i = 0; i != 20003; i++)
+            queries.push_back(i);
+        Vector<uint8_t> out;
+        size_t found = filter.contains_bulk(queries, out);
+        size_t expected = 0;
+        for (size_t i = 0; i != queries.size(); i++)
+        {
+            REQUIRE(bool(out[i]) == filter.contains(queries[i]));
+            expected += out[i];
+        }
+        REQUIRE(found == expected);
+        REQUIRE(filter.contains_bulk(keys, out) == keys.size());
+    }
+}
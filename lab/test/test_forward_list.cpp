@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+
+TEST_CASE("test forward list", "[forward_list]") {
+
+    SECTION("test push_front() insert_after() erase_after()") {
+        ForwardList<std::string> lst;
+        REQUIRE(lst.empty());
+        lst.push_front("c");
+        lst.push_front("a");
+        auto it = lst.insert_after(lst.begin(), "b");
+        REQUIRE(*it == "b");
+        it = lst.insert_after(std::next(it), 2, "d");
+        REQUIRE(lst == ForwardList<std::string>({"a", "b", "c", "d", "d"}));
+        lst.insert_after(lst.before_begin(), {"x", "y"});
+        REQUIRE(lst.front() == "x");
+
+        auto next = lst.erase_after(lst.begin());
+        REQUIRE(*next == "a");
+        next = lst.erase_after(next, lst.end());
+        REQUIRE(next == lst.end());
+        REQUIRE(lst == ForwardList<std::string>({"x", "a"}));
+        lst.pop_front();
+        lst.emplace_front(3, 'z');
+        REQUIRE(lst == ForwardList<std::string>({"zzz", "a"}));
+    }
+
+    SECTION("test splice_after()") {
+        ForwardList<int> a({1, 2, 3});
+        ForwardList<int> b({10, 20, 30, 40});
+        a.splice_after(a.begin(), b, b.begin());
+        REQUIRE(a == ForwardList<int>({1, 20, 2, 3}));
+        REQUIRE(b == ForwardList<int>({10, 30, 40}));
+        a.splice_after(a.before_begin(), b, b.before_begin(), std::next(b.begin(), 2));
+        REQUIRE(a == ForwardList<int>({10, 30, 1, 20, 2, 3}));
+        REQUIRE(b == ForwardList<int>({40}));
+        a.splice_after(std::next(a.begin(), 5), b);
+        REQUIRE(b.empty());
+        REQUIRE(a == ForwardList<int>({10, 30, 1, 20, 2, 3, 40}));
+        a.splice_after(a.before_begin(), a, std::next(a.begin(), 5));
+        REQUIRE(a.front() == 40);
+    }
+
+    SECTION("test sort() merge() reverse() remove()") {
+        std::mt19937 rng(5);
+        std::vector<std::pair<int, int>> keys;
+        for (int i = 0; i < 1000; i++)
+            keys.emplace_back((int)(rng() % 50), i);
+        ForwardList<std::pair<int, int>> lst(keys.begin(), keys.end());
+        auto by_first = [](auto const &x, auto const &y) { return x.first < y.first; };
+        lst.sort(by_first);
+        std::stable_sort(keys.begin(), keys.end(), by_first);
+        REQUIRE(lst == ForwardList<std::pair<int, int>>(keys.begin(), keys.end()));
+
+        ForwardList<int> a({1, 3, 5, 7});
+        ForwardList<int> b({2, 3, 6});
+        a.merge(b);
+        REQUIRE(b.empty());
+        REQUIRE(a == ForwardList<int>({1, 2, 3, 3, 5, 6, 7}));
+        a.reverse();
+        REQUIRE(a == ForwardList<int>({7, 6, 5, 3, 3, 2, 1}));
+        REQUIRE(a.remove(a.front()) == 1);
+        REQUIRE(erase(a, 3) == 2);
+        REQUIRE(erase_if(a, [](int x) { return x % 2 == 0; }) == 2);
+        REQUIRE(a == ForwardList<int>({5, 1}));
+
+        ForwardList<int> c(a);
+        REQUIRE(c == a);
+        ForwardList<int> d(std::move(c));
+        REQUIRE(c.empty());
+        REQUIRE(d > ForwardList<int>({5}));
+        d = a;
+        REQUIRE(d == a);
+    }
+}
@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <array>
+#include <bit>
+#include <string>
+#include <vector>
+#include <string_view>
+#include <tuple>
+#include <random>
+#include <unordered_set>
+
+//? 编译期生成的伪随机文本, 用来比较编译期与运行期 (SSE2) 的哈希结果
+static constexpr auto hash_text = []
+{
+    std::array<char, 5000> text{};
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    for (char &c : text)
+    {
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        c = char(x >> 56);
+    }
+    return text;
+}();
+
+static constexpr size_t hash_lengths[] = {0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 48, 49, 64, 65,
+                                          127, 128, 129, 191, 192, 255, 1023, 1024, 1025, 4096, 5000};
+
+static constexpr auto compile_time_hashes = []
+{
+    std::array<uint64_t, std::size(hash_lengths)> hashes{};
+    for (size_t i = 0; i != hashes.size(); i++)
+        hashes[i] = hash_bytes(std::string_view(hash_text.data(), hash_lengths[i]));
+    return hashes;
+}();
+
+struct Point
+{
+    int x;
+    int y;
+    std::string name;
+
+    auto tie() const
+    {
+        return std::tie(x, y, name);
+    }
+
+    bool operator==(Point const &) const = default;
+};
+
+template <class Gen>
+static double chi_square(size_t keys, size_t buckets, Gen gen)
+{ //? 用哈希值的低位分桶, 返回卡方统计量 (自由度 buckets - 1)
+    std::vector<size_t> count(buckets, 0);
+    for (size_t i = 0; i != keys; i++)
+        count[gen(i) & (buckets - 1)]++;
+    double expected = double(keys) / buckets, chi = 0;
+    for (size_t c : count)
+        chi += (c - expected) * (c - expected) / expected;
+    return chi;
+}
+
+TEST_CASE("test hash", "[hash]") {
+
+    SECTION("test compile time and runtime agree") {
+        for (size_t i = 0; i != std::size(hash_lengths); i++)
+        {
+            std::string copy(hash_text.data(), hash_lengths[i]); //? 换一个地址, 对齐不同
+            REQUIRE(hash_bytes(copy.data(), copy.size()) == compile_time_hashes[i]);
+            REQUIRE(Hasher<std::string>()(copy) == compile_time_hashes[i]);
+        }
+        STATIC_REQUIRE(Hasher<std::string_view>()("abc") == hash_bytes(std::string_view("abc")));
+        REQUIRE(Hasher<std::string>()("abc") == Hasher<std::string_view>()("abc"));
+        REQUIRE(hash_bytes("abc", 3, 1) != hash_bytes("abc", 3, 2));
+    }
+
+    SECTION("test low bits distribution") {
+        //? 2^16 个键分到 4096 个桶, 卡方统计量的期望为 4095, 标准差约 90
+        constexpr double limit = 4095 + 6 * 90.5;
+        Hasher<uint64_t> h;
+        REQUIRE(chi_square(1 << 16, 4096, [&](size_t i) { return h(i); }) < limit);
+        REQUIRE(chi_square(1 << 16, 4096, [&](size_t i) { return h(i << 12); }) < limit);
+        REQUIRE(chi_square(1 << 16, 4096, [&](size_t i) { return h(i << 40); }) < limit);
+        Hasher<std::string> hs;
+        REQUIRE(chi_square(1 << 16, 4096, [&](size_t i) { return hs("key" + std::to_string(i)); }) < limit);
+        std::string long_key(300, 'x');
+        REQUIRE(chi_square(1 << 16, 4096, [&](size_t i) {
+            long_key.replace(150, 8, std::to_string(10000000 + i));
+            return hs(long_key);
+        }) < limit);
+    }
+
+    SECTION("test no collisions on near-identical keys") {
+        for (size_t len : {3, 12, 40, 100, 200, 2000})
+        {
+            std::string base(len, 'a');
+            std::unordered_set<uint64_t> seen;
+            size_t count = 0;
+            for (size_t pos = 0; pos != len; pos++)
+                for (int bit = 0; bit != 8; bit++, count++)
+                {
+                    std::string key = base;
+                    key[pos] ^= char(1 << bit);
+                    seen.insert(hash_bytes(key));
+                }
+            seen.insert(hash_bytes(base));
+            REQUIRE(seen.size() == count + 1);
+        }
+        std::unordered_set<uint64_t> seen;
+        for (int i = 0; i != 200000; i++)
+            seen.insert(Hasher<std::string>()(std::to_string(i)));
+        REQUIRE(seen.size() == 200000);
+    }
+
+    SECTION("test avalanche") {
+        //? 翻转输入的任一位, 输出平均应翻转约一半 (32) 位
+        std::mt19937_64 rng(7);
+        for (size_t len : {8, 24, 100, 300})
+        {
+            double flips = 0;
+            size_t trials = 0;
+            for (int round = 0; round != 20; round++)
+            {
+                std::string key(len, '\0');
+                for (char &c : key)
+                    c = char(rng());
+                uint64_t h0 = hash_bytes(key);
+                for (size_t bit = 0; bit != len * 8; bit++, trials++)
+                {
+                    key[bit / 8] ^= char(1 << (bit % 8));
+                    flips += std::popcount(h0 ^ hash_bytes(key));
+                    key[bit / 8] ^= char(1 << (bit % 8));
+                }
+            }
+            REQUIRE(flips / trials > 30);
+            REQUIRE(flips / trials < 34);
+        }
+        double flips = 0;
+        for (int bit = 0; bit != 64; bit++)
+            for (uint64_t x = 1; x != 1000; x++)
+                flips += std::popcount(Hasher<uint64_t>()(x) ^ Hasher<uint64_t>()(x ^ (uint64_t(1) << bit)));
+        REQUIRE(flips / (64 * 999) > 30);
+        REQUIRE(flips / (64 * 999) < 34);
+    }
+
+    SECTION("test combinators and containers") {
+        Hasher<std::pair<int, int>> hp;
+        REQUIRE(hp({1, 2}) != hp({2, 1}));
+        REQUIRE(Hasher<std::tuple<int, std::string>>()({1, "a"}) == hash_values(1, std::string("a")));
+        REQUIRE(Hasher<Point>()({1, 2, "p"}) == hash_values(1, 2, std::string("p")));
+        REQUIRE(Hasher<double>()(0.0) == Hasher<double>()(-0.0));
+        REQUIRE(Hasher<double>()(1.0) != Hasher<double>()(2.0));
+
+        HashSet<Point> points{{1, 2, "a"}, {2, 1, "b"}};
+        REQUIRE(points.contains({1, 2, "a"}));
+        REQUIRE_FALSE(points.contains({1, 2, "b"}));
+        UnorderedMap<std::pair<int, int>, int> grid;
+        grid[{3, 4}] = 7;
+        REQUIRE(grid.at({3, 4}) == 7);
+    }
+
+    SECTION("test avalanching tag") {
+        //? 容器只对未声明 is_avalanching 的哈希 (如恒等映射的 std::hash<int>) 再混合一次
+        STATIC_REQUIRE(is_avalanching_v<Hasher<int>>);
+        STATIC_REQUIRE(is_avalanching_v<Hasher<std::string>>);
+        STATIC_REQUIRE(is_avalanching_v<Hasher<Point>>);
+        STATIC_REQUIRE(is_avalanching_v<Hasher<std::vector<bool>>>);
+        STATIC_REQUIRE_FALSE(is_avalanching_v<std::hash<int>>);
+
+        HashSet<uint64_t, std::hash<uint64_t>> identity;
+        for (uint64_t i = 0; i != 4096; i++)
+            identity.insert(i << 20); //? 低 20 位全为零, 不再混合就会挤在同一组
+        for (uint64_t i = 0; i != 4096; i++)
+            REQUIRE(identity.contains(i << 20));
+        REQUIRE(identity.size() == 4096);
+    }
+}
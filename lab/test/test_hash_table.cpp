@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <random>
+#include <stdexcept>
+
+struct StringHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view s) const
+    {
+        return std::hash<std::string_view>()(s);
+    }
+};
+
+TEST_CASE("test hash table", "[hash_table]") {
+
+    SECTION("test HashMap insert() find() erase() against std::unordered_map") {
+        HashMap<int, int> map;
+        std::unordered_map<int, int> ref;
+        std::mt19937 rng(1);
+        for (int i = 0; i < 200000; i++)
+        {
+            int key = (int)(rng() % 5000);
+            switch (rng() % 4)
+            {
+            case 0:
+            case 1:
+                map.insert_or_assign(key, i);
+                ref.insert_or_assign(key, i);
+                break;
+            case 2:
+                REQUIRE(map.erase(key) == ref.erase(key));
+                break;
+            case 3:
+                auto it = map.find(key);
+                auto rit = ref.find(key);
+                REQUIRE((it == map.end()) == (rit == ref.end()));
+                if (rit != ref.end())
+                    REQUIRE(it->second == rit->second);
+                break;
+            }
+        }
+        REQUIRE(map.size() == ref.size());
+        size_t visited = 0;
+        for (auto const &[k, v] : map)
+        {
+            REQUIRE(ref.at(k) == v);
+            visited++;
+        }
+        REQUIRE(visited == ref.size());
+        REQUIRE(map.load_factor() <= map.max_load_factor());
+    }
+
+    SECTION("test reserve() rehash() operator[] at()") {
+        HashMap<std::string, int> map;
+        map.reserve(1000);
+        size_t cap = map.capacity();
+        REQUIRE(cap >= 1000);
+        for (int i = 0; i < 1000; i++)
+            map[std::to_string(i)] = i;
+        REQUIRE(map.capacity() == cap);
+        REQUIRE(map.at("999") == 999);
+        REQUIRE_THROWS_AS(map.at("1000"), std::out_of_range);
+        REQUIRE(map.try_emplace("5", -1).second == false);
+        REQUIRE(map["5"] == 5);
+
+        REQUIRE(erase_if(map, [](auto const &kv) { return kv.second >= 10; }) == 990);
+        map.rehash(0);
+        REQUIRE(map.capacity() == 16);
+        REQUIRE(map.size() == 10);
+        for (int i = 0; i < 10; i++)
+            REQUIRE(map.contains(std::to_string(i)));
+
+        HashMap<std::string, int> cpy(map);
+        REQUIRE(cpy == map);
+        cpy["x"] = 1;
+        REQUIRE_FALSE(cpy == map);
+        HashMap<std::string, int> mov(std::move(cpy));
+        REQUIRE(cpy.empty());
+        REQUIRE(cpy.find("x") == cpy.end());
+        REQUIRE(mov.size() == 11);
+        mov.clear();
+        REQUIRE(mov.empty());
+        REQUIRE(mov.begin() == mov.end());
+    }
+
+    SECTION("test heterogeneous lookup and HashSet") {
+        HashSet<std::string, StringHash, std::equal_to<>> set({"alpha", "beta", "gamma"});
+        std::string_view key = "beta";
+        REQUIRE(set.contains(key));
+        REQUIRE(set.find(std::string_view("delta")) == set.end());
+        REQUIRE(set.count("gamma") == 1);
+        REQUIRE(set.erase(std::string_view("alpha")) == 1);
+        REQUIRE(set.size() == 2);
+        REQUIRE_FALSE(set.insert("beta").second);
+        REQUIRE(set.emplace(3, 'z').second);
+        auto it = set.erase(set.find("zzz"));
+        REQUIRE(set.size() == 2);
+        (void)it;
+    }
+}
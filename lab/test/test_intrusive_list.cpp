@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <vector>
+#include <memory>
+
+struct Task
+{
+    int id;
+    IntrusiveListHook<> run_hook;
+    IntrusiveListHook<> timer_hook;
+};
+
+struct Entry
+{
+    int key;
+    IntrusiveListHook<true> hook;
+};
+
+template <class Lst>
+static std::vector<int> ids(Lst const &lst)
+{
+    std::vector<int> res;
+    for (auto const &obj : lst)
+        res.push_back(obj.id);
+    return res;
+}
+
+TEST_CASE("test intrusive list", "[intrusive_list]") {
+
+    SECTION("test one object on several lists") {
+        std::vector<Task> tasks(5);
+        for (int i = 0; i < 5; i++)
+            tasks[i].id = i;
+        IntrusiveList<Task, &Task::run_hook> run_queue;
+        IntrusiveList<Task, &Task::timer_hook> timers;
+        for (auto &t : tasks)
+            run_queue.push_back(t);
+        for (auto it = tasks.rbegin(); it != tasks.rend(); ++it)
+            timers.push_back(*it);
+        REQUIRE(run_queue.size() == 5);
+        REQUIRE(ids(run_queue) == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(ids(timers) == std::vector<int>{4, 3, 2, 1, 0});
+
+        run_queue.erase(tasks[2]);
+        REQUIRE_FALSE(tasks[2].run_hook.is_linked());
+        REQUIRE(tasks[2].timer_hook.is_linked());
+        REQUIRE(ids(run_queue) == std::vector<int>{0, 1, 3, 4});
+        REQUIRE(ids(timers) == std::vector<int>{4, 3, 2, 1, 0});
+
+        run_queue.push_front(tasks[2]);
+        run_queue.pop_back();
+        REQUIRE(run_queue.front().id == 2);
+        REQUIRE(run_queue.back().id == 3);
+        REQUIRE(&*run_queue.iterator_to(tasks[1]) == &tasks[1]);
+        REQUIRE(std::prev(run_queue.end())->id == 3);
+
+        timers.clear();
+        for (auto &t : tasks)
+            REQUIRE_FALSE(t.timer_hook.is_linked());
+        REQUIRE(run_queue.size() == 4);
+    }
+
+    SECTION("test splice as LRU touch and move") {
+        std::vector<Task> tasks(4);
+        IntrusiveList<Task, &Task::run_hook> lru;
+        for (int i = 0; i < 4; i++)
+        {
+            tasks[i].id = i;
+            lru.push_back(tasks[i]);
+        }
+        lru.splice(lru.begin(), lru, lru.iterator_to(tasks[3]));
+        lru.splice(lru.begin(), lru, lru.iterator_to(tasks[3]));
+        REQUIRE(ids(lru) == std::vector<int>{3, 0, 1, 2});
+        REQUIRE(lru.size() == 4);
+
+        IntrusiveList<Task, &Task::run_hook> other(std::move(lru));
+        REQUIRE(lru.empty());
+        REQUIRE(ids(other) == std::vector<int>{3, 0, 1, 2});
+        lru.splice(lru.end(), other);
+        REQUIRE(other.empty());
+        REQUIRE(lru.size() == 4);
+        REQUIRE(ids(lru) == std::vector<int>{3, 0, 1, 2});
+        lru.erase(std::next(lru.begin()), lru.end());
+        REQUIRE(ids(lru) == std::vector<int>{3});
+    }
+
+    SECTION("test auto-unlink on destruction") {
+        IntrusiveList<Entry, &Entry::hook> lst;
+        auto a = std::make_unique<Entry>(Entry{1, {}});
+        Entry b{2, {}};
+        auto c = std::make_unique<Entry>(Entry{3, {}});
+        lst.push_back(*a);
+        lst.push_back(b);
+        lst.push_back(*c);
+        REQUIRE(lst.size() == 3);
+        a.reset();
+        REQUIRE(lst.size() == 2);
+        REQUIRE(lst.front().key == 2);
+        c->hook.unlink();
+        REQUIRE(lst.size() == 1);
+        REQUIRE(lst.back().key == 2);
+        c.reset();
+        Entry d = b;
+        REQUIRE_FALSE(d.hook.is_linked());
+    }
+}
@@ -3,6 +3,9 @@
 #include <miniSTL/stl.hpp>
 #include <vector>
 #include <list>
+#include <algorithm>
+#include <functional>
+#include <string>
 
 struct M_int {
     int m_value;
@@ -100,4 +103,206 @@ TEST_CASE("test list", "[list]") {
         REQUIRE(a == a);
         REQUIRE_FALSE(a == b);
     }
+
+    SECTION("test operator<=>") {
+        List<int> a({0, 1, 2, 3, 4, 5});
+        List<int> b({0, 1, 2, 3, 4, 6});
+        List<int> c({0, 1, 2});
+        REQUIRE(a == a);
+        REQUIRE(a < b);
+        REQUIRE(c < a);
+        REQUIRE(b > c);
+        REQUIRE((a <=> List<int>({0, 1, 2, 3, 4, 5})) == std::strong_ordering::equal);
+    }
+
+    SECTION("test remove() remove_if() unique() erase_if()") {
+        List<int> lst({0, 1, 2, 1, 3, 1});
+        REQUIRE(lst.remove(1) == 3);
+        REQUIRE(lst == List<int>({0, 2, 3}));
+        REQUIRE(lst.size() == 3);
+
+        List<int> self({5, 1, 5, 5});
+        REQUIRE(self.remove(self.front()) == 3);
+        REQUIRE(self == List<int>({1}));
+
+        List<int> odd({0, 1, 2, 3, 4, 5});
+        REQUIRE(erase_if(odd, [](int x) { return x % 2 == 1; }) == 3);
+        REQUIRE(odd == List<int>({0, 2, 4}));
+
+        List<int> dup({1, 1, 2, 2, 2, 3, 1});
+        REQUIRE(dup.unique() == 3);
+        REQUIRE(dup == List<int>({1, 2, 3, 1}));
+    }
+
+    SECTION("test PoolAllocator node recycling") {
+        PoolAllocator<int> alloc;
+        List<int, PoolAllocator<int>> lst(alloc);
+        for (int i = 0; i < 100; i++)
+            lst.push_back(i);
+        size_t chunks = alloc.m_pool->chunk_count();
+        REQUIRE(chunks == 1);
+        for (int i = 0; i < 100000; i++) {
+            lst.push_back(i);
+            lst.pop_front();
+        }
+        REQUIRE(alloc.m_pool->chunk_count() == chunks);
+        REQUIRE(lst.size() == 100);
+        REQUIRE(lst.front() == 99900);
+        REQUIRE(lst.back() == 99999);
+
+        List<int, PoolAllocator<int>> shared({1, 2, 3}, alloc);
+        REQUIRE(shared == List<int, PoolAllocator<int>>({1, 2, 3}));
+        List<int, PoolAllocator<int>> moved(std::move(lst));
+        REQUIRE(moved.size() == 100);
+        lst.push_back(1);
+        REQUIRE(lst.front() == 1);
+        REQUIRE(alloc.m_pool->chunk_count() == chunks);
+
+        long owners = alloc.m_pool.use_count();
+        List<int, PoolAllocator<int>> copy(moved);
+        REQUIRE(copy == moved);
+        REQUIRE(alloc.m_pool.use_count() == owners); //? 拷贝得到新的池, 不与原链表共享
+    }
+
+    SECTION("test splice() a node onto itself") {
+        List<int> l({1, 2, 3});
+        auto it = std::next(l.begin());
+        l.splice(it, l, it);
+        REQUIRE(l == List<int>({1, 2, 3}));
+        l.splice(std::next(it), l, it);
+        REQUIRE(l == List<int>({1, 2, 3}));
+        l.splice(it, l, it, std::next(it));
+        REQUIRE(l == List<int>({1, 2, 3}));
+        REQUIRE(l.size() == 3);
+        REQUIRE(*it == 2);
+        l.splice(l.end(), l, it);
+        REQUIRE(l == List<int>({1, 3, 2}));
+    }
+
+    SECTION("test splice() merge() sort() reverse()") {
+        List<int> a({1, 2, 3});
+        List<int> b({10, 20, 30});
+        auto it20 = std::next(b.begin());
+        a.splice(std::next(a.begin()), b, it20);
+        REQUIRE(a == List<int>({1, 20, 2, 3}));
+        REQUIRE(b == List<int>({10, 30}));
+        REQUIRE(*it20 == 20);
+        a.splice(a.end(), b);
+        REQUIRE(a == List<int>({1, 20, 2, 3, 10, 30}));
+        REQUIRE(b.empty());
+        REQUIRE(a.size() == 6);
+        b.splice(b.begin(), a, std::next(a.begin()), std::prev(a.end()));
+        REQUIRE(b == List<int>({20, 2, 3, 10}));
+        REQUIRE(a == List<int>({1, 30}));
+        REQUIRE(a.size() == 2);
+        REQUIRE(b.size() == 4);
+        a.splice(a.begin(), a, std::next(a.begin()));
+        REQUIRE(a == List<int>({30, 1}));
+
+        b.sort();
+        REQUIRE(b == List<int>({2, 3, 10, 20}));
+        a.sort();
+        a.merge(b);
+        REQUIRE(a == List<int>({1, 2, 3, 10, 20, 30}));
+        REQUIRE(a.size() == 6);
+        REQUIRE(b.empty());
+
+        a.reverse();
+        REQUIRE(a == List<int>({30, 20, 10, 3, 2, 1}));
+        REQUIRE(a.back() == 1);
+        a.sort(std::greater<>());
+        REQUIRE(a == List<int>({30, 20, 10, 3, 2, 1}));
+
+        std::vector<int> ref;
+        List<std::pair<int, int>> big;
+        for (int i = 0; i < 1000; i++) {
+            int key = (i * 7919) % 97;
+            ref.push_back(key);
+            big.emplace_back(key, i);
+        }
+        std::stable_sort(ref.begin(), ref.end());
+        big.sort([](auto const &x, auto const &y) { return x.first < y.first; });
+        auto it = big.begin();
+        int prev = -1;
+        for (int i = 0; i < 1000; i++, ++it) {
+            REQUIRE((*it).first == ref[i]);
+            if (i > 0 && ref[i] == ref[i - 1])
+                REQUIRE((*it).second > prev); //? 稳定性: 相等键保持原有顺序
+            prev = (*it).second;
+        }
+        REQUIRE(it == big.end());
+        size_t back_count = 0;
+        for (auto rit = big.end(); rit != big.begin(); --rit)
+            back_count++;
+        REQUIRE(back_count == 1000);
+    }
+
+    SECTION("test bulk node allocation and size()") {
+        List<int> a(5, 7);
+        REQUIRE(a.size() == 5);
+        List<int> b(4);
+        REQUIRE(b.size() == 4);
+        REQUIRE(b.front() == 0);
+        a.assign(3, 1);
+        REQUIRE(a.size() == 3);
+        auto it = a.insert(std::next(a.begin()), 2, 9);
+        REQUIRE(*it == 9);
+        REQUIRE(a == List<int>({1, 9, 9, 1, 1}));
+        REQUIRE(a.size() == 5);
+        std::vector<int> v({4, 5, 6});
+        it = a.insert(a.end(), v.begin(), v.end());
+        REQUIRE(*it == 4);
+        REQUIRE(a.size() == 8);
+
+        PoolAllocator<int> alloc;
+        List<int, PoolAllocator<int>> p(alloc);
+        p.assign(1000, 3);
+        REQUIRE(p.size() == 1000);
+        REQUIRE(alloc.m_pool->chunk_count() == 1);
+        //? 已知个数时节点地址连续且按链表顺序排列
+        int const *prev = &p.front();
+        bool contiguous = true;
+        for (auto pit = std::next(p.begin()); pit != p.end(); ++pit) {
+            if (reinterpret_cast<char const *>(&*pit) - reinterpret_cast<char const *>(prev) !=
+                (std::ptrdiff_t)alloc.m_pool->block_size())
+                contiguous = false;
+            prev = &*pit;
+        }
+        REQUIRE(contiguous);
+        p.erase(std::next(p.begin()), p.end());
+        p.insert(p.end(), v.begin(), v.end());
+        REQUIRE(p == List<int, PoolAllocator<int>>({3, 4, 5, 6}, alloc));
+    }
+
+    SECTION("test compact()") {
+        List<std::string> s_lst;
+        for (int i = 0; i < 100; i++)
+            s_lst.push_back(std::to_string(i));
+        erase_if(s_lst, [](std::string const &s) { return s.size() == 1; });
+        s_lst.push_front("front");
+        std::vector<std::string> before(s_lst.begin(), s_lst.end());
+        s_lst.compact();
+        REQUIRE(s_lst.size() == before.size());
+        REQUIRE(std::vector<std::string>(s_lst.begin(), s_lst.end()) == before);
+        REQUIRE(std::vector<std::string>(s_lst.rbegin(), s_lst.rend()) ==
+                std::vector<std::string>(before.rbegin(), before.rend()));
+
+        PoolAllocator<int> alloc;
+        List<int, PoolAllocator<int>> p(alloc);
+        for (int i = 0; i < 500; i++) {
+            p.push_front(i);
+            p.push_back(-i);
+        }
+        erase_if(p, [](int x) { return x % 3 == 0; });
+        std::vector<int> vals(p.begin(), p.end());
+        p.compact();
+        REQUIRE(std::vector<int>(p.begin(), p.end()) == vals);
+        //? 压缩后节点按遍历顺序连续排列
+        bool contiguous = true;
+        for (auto pit = std::next(p.begin()); pit != p.end(); ++pit)
+            if (reinterpret_cast<char const *>(&*pit) - reinterpret_cast<char const *>(&*std::prev(pit)) !=
+                (std::ptrdiff_t)alloc.m_pool->block_size())
+                contiguous = false;
+        REQUIRE(contiguous);
+    }
 }
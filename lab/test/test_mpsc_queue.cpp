@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <memory>
+
+struct WorkItem
+{
+    int producer;
+    int seq;
+    MpscHook hook;
+};
+
+TEST_CASE("test mpsc queue", "[mpsc_queue]") {
+
+    SECTION("test single thread FIFO and drain") {
+        MpscQueue<std::string> q;
+        REQUIRE(q.empty());
+        std::string out;
+        REQUIRE_FALSE(q.try_pop(out));
+        for (int i = 0; i < 10; i++)
+            q.push(std::to_string(i));
+        REQUIRE_FALSE(q.empty());
+        REQUIRE(q.try_pop(out));
+        REQUIRE(out == "0");
+        std::vector<std::string> got;
+        REQUIRE(q.drain([&](std::string &&s) { got.push_back(std::move(s)); }, 4) == 4);
+        REQUIRE(got == std::vector<std::string>{"1", "2", "3", "4"});
+        REQUIRE(q.drain([&](std::string &&s) { got.push_back(std::move(s)); }) == 5);
+        REQUIRE(got.back() == "9");
+        REQUIRE(q.empty());
+        q.emplace(3, 'x'); //? 析构时释放剩余元素
+    }
+
+    SECTION("test concurrent producers keep per-producer order") {
+        constexpr int producers = 8;
+        constexpr int per_producer = 20000;
+        std::vector<std::unique_ptr<WorkItem[]>> items;
+        for (int p = 0; p < producers; p++)
+        {
+            items.emplace_back(new WorkItem[per_producer]);
+            for (int i = 0; i < per_producer; i++)
+                items[p][i] = WorkItem{p, i, {}};
+        }
+
+        MpscIntrusiveQueue<WorkItem, &WorkItem::hook> q;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++)
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < per_producer; i++)
+                    q.push(items[p][i]);
+            });
+
+        std::vector<int> next_seq(producers, 0);
+        bool in_order = true;
+        size_t total = 0;
+        while (total != (size_t)producers * per_producer)
+        {
+            total += q.drain([&](WorkItem &item) {
+                in_order = in_order && item.seq == next_seq[item.producer];
+                next_seq[item.producer] = item.seq + 1;
+            });
+            std::this_thread::yield();
+        }
+        for (auto &t : threads)
+            t.join();
+        REQUIRE(in_order);
+        REQUIRE(q.pop() == nullptr);
+        REQUIRE(q.empty());
+        for (int p = 0; p < producers; p++)
+            REQUIRE(next_seq[p] == per_producer);
+    }
+
+    SECTION("test concurrent owning queue sum") {
+        constexpr int producers = 4;
+        constexpr int per_producer = 50000;
+        MpscQueue<long long> q;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++)
+            threads.emplace_back([&] {
+                for (int i = 1; i <= per_producer; i++)
+                    q.push(i);
+            });
+        long long sum = 0;
+        size_t total = 0;
+        while (total != (size_t)producers * per_producer)
+            total += q.drain([&](long long x) { sum += x; });
+        for (auto &t : threads)
+            t.join();
+        REQUIRE(sum == (long long)producers * per_producer * (per_producer + 1) / 2);
+    }
+}
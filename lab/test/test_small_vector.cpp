@@ -0,0 +1,207 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
+
+//? 复制到第 limit 次时抛出异常, 用于检查插入失败后容器仍然完好
+struct ThrowOnCopy
+{
+    static inline int copies = 0;
+    static inline int limit = -1;
+    static inline int alive = 0;
+    int m_value;
+
+    ThrowOnCopy(int v) : m_value(v) { alive++; }
+    ThrowOnCopy(ThrowOnCopy const &that) : m_value(that.m_value)
+    {
+        if (++copies == limit)
+            throw std::runtime_error("copy");
+        alive++;
+    }
+    ThrowOnCopy(ThrowOnCopy &&that) noexcept : m_value(that.m_value) { alive++; }
+    ~ThrowOnCopy() { alive--; }
+};
+
+//? 每次分配在块头记下分配器的编号, 释放时核对, 统计用错分配器释放的次数
+template <class T>
+struct TaggedAllocator
+{
+    using value_type = T;
+    static inline int mismatches = 0;
+    static constexpr size_t header = alignof(std::max_align_t);
+    int m_tag;
+
+    explicit TaggedAllocator(int tag) : m_tag(tag) {}
+
+    T *allocate(size_t n)
+    {
+        char *p = static_cast<char *>(::operator new(header + n * sizeof(T)));
+        *reinterpret_cast<int *>(p) = m_tag;
+        return reinterpret_cast<T *>(p + header);
+    }
+
+    void deallocate(T *p, size_t) noexcept
+    {
+        char *block = reinterpret_cast<char *>(p) - header;
+        mismatches += *reinterpret_cast<int *>(block) != m_tag;
+        ::operator delete(block);
+    }
+
+    bool operator==(TaggedAllocator const &that) const noexcept
+    {
+        return m_tag == that.m_tag;
+    }
+};
+
+TEST_CASE("test small vector", "[small_vector]") {
+
+    SECTION("test inline storage and spill to heap") {
+        SmallVector<std::string, 4> s_vec;
+        REQUIRE(s_vec.is_small());
+        REQUIRE(s_vec.capacity() == 4);
+        for (int i = 0; i < 4; i++)
+            s_vec.push_back(std::to_string(i));
+        REQUIRE(s_vec.is_small());
+        s_vec.emplace_back(s_vec[0]);
+        REQUIRE_FALSE(s_vec.is_small());
+        REQUIRE(s_vec.size() == 5);
+        for (int i = 0; i < 4; i++)
+            REQUIRE(s_vec[i] == std::to_string(i));
+        REQUIRE(s_vec.back() == "0");
+
+        s_vec.erase(s_vec.begin(), s_vec.begin() + 2);
+        s_vec.shrink_to_fit();
+        REQUIRE(s_vec.is_small());
+        REQUIRE(s_vec == SmallVector<std::string, 4>({"2", "3", "0"}));
+    }
+
+    SECTION("test insert() erase() resize() assign()") {
+        SmallVector<int, 8> i_vec({0, 1, 2, 3});
+        i_vec.insert(i_vec.begin() + 1, 3, -1);
+        REQUIRE(i_vec == SmallVector<int, 8>({0, -1, -1, -1, 1, 2, 3}));
+        int arr[] = {7, 8, 9};
+        i_vec.insert(i_vec.end(), arr, arr + 3);
+        REQUIRE(i_vec.size() == 10);
+        REQUIRE_FALSE(i_vec.is_small());
+        i_vec.erase(i_vec.begin() + 1, i_vec.begin() + 4);
+        REQUIRE(i_vec == SmallVector<int, 8>({0, 1, 2, 3, 7, 8, 9}));
+        i_vec.resize(2);
+        i_vec.resize(4, 5);
+        REQUIRE(i_vec == SmallVector<int, 8>({0, 1, 5, 5}));
+        i_vec.assign(3, i_vec[0]);
+        REQUIRE(i_vec == SmallVector<int, 8>({0, 0, 0}));
+        REQUIRE_THROWS_AS(i_vec.at(3), std::out_of_range);
+    }
+
+    SECTION("test copy move swap") {
+        SmallVector<std::string, 2> a({"a", "b"});
+        SmallVector<std::string, 2> b({"c", "d", "e"});
+        SmallVector<std::string, 2> c(a);
+        REQUIRE(c == a);
+        a.swap(b);
+        REQUIRE(a == SmallVector<std::string, 2>({"c", "d", "e"}));
+        REQUIRE(b == c);
+        std::string const *heap = a.data();
+        SmallVector<std::string, 2> d(std::move(a));
+        REQUIRE(d.data() == heap);
+        REQUIRE(a.empty());
+        d = std::move(b);
+        REQUIRE(d == c);
+    }
+
+    SECTION("test conversion with Vector") {
+        Vector<int> vec({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        int const *heap = vec.data();
+        SmallVector<int, 4> s_vec(std::move(vec));
+        REQUIRE(s_vec.data() == heap);
+        REQUIRE(vec.empty());
+
+        Vector<int> back = std::move(s_vec);
+        REQUIRE(back.data() == heap);
+        REQUIRE(back.size() == 10);
+        REQUIRE(s_vec.empty());
+
+        SmallVector<int, 4> small({1, 2});
+        Vector<int> copy = small;
+        REQUIRE(copy == Vector<int>({1, 2}));
+        small = Vector<int>({3});
+        REQUIRE(small.is_small());
+        REQUIRE(small[0] == 3);
+    }
+
+    SECTION("test input iterators") {
+        std::istringstream in("1 2 3 4 5 6");
+        SmallVector<int, 4> s_vec{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+        REQUIRE(s_vec == SmallVector<int, 4>({1, 2, 3, 4, 5, 6}));
+
+        std::istringstream mid("7 8");
+        s_vec.insert(s_vec.begin() + 1, std::istream_iterator<int>(mid), std::istream_iterator<int>());
+        REQUIRE(s_vec == SmallVector<int, 4>({1, 7, 8, 2, 3, 4, 5, 6}));
+
+        std::istringstream few("9 10");
+        s_vec.assign(std::istream_iterator<int>(few), std::istream_iterator<int>());
+        REQUIRE(s_vec == SmallVector<int, 4>({9, 10}));
+    }
+
+    SECTION("test noexcept move depends on element type") {
+        struct ThrowingMove
+        {
+            ThrowingMove() = default;
+            ThrowingMove(ThrowingMove const &) {}
+            ThrowingMove(ThrowingMove &&) noexcept(false) {}
+        };
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<SmallVector<int, 4>>);
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<SmallVector<std::string, 4>>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_move_constructible_v<SmallVector<ThrowingMove, 4>>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_move_assignable_v<SmallVector<ThrowingMove, 4>>);
+    }
+
+    SECTION("test insert keeps the vector intact when a copy throws") {
+        for (int grow = 0; grow != 2; grow++)
+        {
+            SmallVector<ThrowOnCopy, 4> s_vec;
+            s_vec.reserve(grow ? 4 : 8);
+            for (int i = 0; i != 4; i++)
+                s_vec.emplace_back(i);
+            std::vector<ThrowOnCopy> src{10, 11, 12};
+            ThrowOnCopy::copies = 0;
+            ThrowOnCopy::limit = 2;
+            REQUIRE_THROWS_AS(s_vec.insert(s_vec.begin() + 1, src.begin(), src.end()), std::runtime_error);
+            ThrowOnCopy::copies = 0;
+            ThrowOnCopy::limit = 3; //? 第 1 次复制是 tmp, 第 3 次是填充第 2 个元素
+            REQUIRE_THROWS_AS(s_vec.insert(s_vec.begin() + 1, 3, src[0]), std::runtime_error);
+            ThrowOnCopy::limit = -1;
+            REQUIRE(s_vec.size() == 4);
+            for (int i = 0; i != 4; i++)
+                REQUIRE(s_vec[i].m_value == i);
+            REQUIRE(ThrowOnCopy::alive == 7);
+        }
+        REQUIRE(ThrowOnCopy::alive == 0);
+    }
+
+    SECTION("test move assignment frees through the owning allocator") {
+        using Tagged = TaggedAllocator<int>;
+        TaggedAllocator<int>::mismatches = 0;
+        {
+            SmallVector<int, 2, Tagged> a(Tagged(1)), b(Tagged(2));
+            for (int i = 0; i != 10; i++)
+                b.push_back(i);
+            a = std::move(b);
+            REQUIRE(a.size() == 10);
+            a.push_back(10); //? 重新分配: 旧缓冲区由分配它的 2 号分配器释放
+            b.push_back(1);
+
+            Vector<int, Tagged> vec(Tagged(3));
+            for (int i = 0; i != 10; i++)
+                vec.push_back(i);
+            a = std::move(vec);
+            REQUIRE(a.size() == 10);
+            SmallVector<int, 2, Tagged> c(std::move(a));
+            REQUIRE(c.size() == 10);
+        }
+        REQUIRE(TaggedAllocator<int>::mismatches == 0);
+    }
+}
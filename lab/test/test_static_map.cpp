@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <string_view>
+#include <array>
+
+enum class Opcode : uint8_t
+{
+    Nop,
+    Load,
+    Store,
+    Jump,
+};
+
+static constexpr auto keywords = make_static_map<std::string_view, int>({
+    {"if", 1}, {"else", 2}, {"while", 3}, {"for", 4}, {"return", 5}, {"break", 6},
+    {"continue", 7}, {"switch", 8}, {"case", 9}, {"default", 10}, {"a_rather_long_keyword_name", 11},
+});
+
+//? 编译期生成 N 个不同的键, 检查较大的键集也能构建
+template <size_t N>
+static constexpr auto make_int_entries()
+{
+    std::array<std::pair<uint64_t, uint32_t>, N> arr{};
+    for (size_t i = 0; i != N; i++)
+        arr[i] = {i * 0x10001ull + 7, uint32_t(i)};
+    return arr;
+}
+
+TEST_CASE("test static map", "[static_map]") {
+
+    SECTION("test string keys") {
+        STATIC_REQUIRE(keywords.size() == 11);
+        STATIC_REQUIRE(keywords.at("while") == 3);
+        STATIC_REQUIRE_FALSE(keywords.contains("goto"));
+        REQUIRE(keywords.at(std::string("return")) == 5);
+        REQUIRE(keywords["a_rather_long_keyword_name"] == 11);
+        REQUIRE(keywords.find("retur") == keywords.end());
+        REQUIRE(keywords.count("") == 0);
+        REQUIRE_THROWS_AS(keywords.at("goto"), std::out_of_range);
+        int sum = 0;
+        for (auto const &[k, v] : keywords)
+        { //? 运行期的哈希 (按字节块读取) 与编译期构建时的结果一致
+            sum += v;
+            REQUIRE(keywords.at(std::string(k)) == v);
+        }
+        REQUIRE(sum == 66);
+    }
+
+    SECTION("test enum values and integer keys") {
+        static constexpr auto ops = make_static_map<uint8_t, Opcode>({
+            {0x00, Opcode::Nop}, {0x8B, Opcode::Load}, {0x89, Opcode::Store}, {0xE9, Opcode::Jump},
+        });
+        STATIC_REQUIRE(ops.at(0x89) == Opcode::Store);
+        REQUIRE_FALSE(ops.contains(0x90));
+        STATIC_REQUIRE_FALSE(ops.contains(256));
+        REQUIRE_FALSE(ops.contains(0x100 + 0x89));
+        REQUIRE_FALSE(ops.contains(0x8B - 0x100));
+        REQUIRE(ops.contains(uint64_t(0xE9)));
+
+        static constexpr auto offsets = make_static_map<int, int>({{-1, 10}, {2, 20}});
+        STATIC_REQUIRE(offsets.at(int64_t(-1)) == 10);
+        REQUIRE_FALSE(offsets.contains(0xFFFFFFFFu));
+        REQUIRE_FALSE(offsets.contains(int64_t(2) + 0x100000000ll));
+
+        static constexpr StaticMap<uint64_t, uint32_t, 1000> big(make_int_entries<1000>());
+        for (uint64_t i = 0; i != 1000; i++)
+        {
+            REQUIRE(big.at(i * 0x10001ull + 7) == i);
+            REQUIRE_FALSE(big.contains(i * 0x10001ull + 8));
+        }
+    }
+}
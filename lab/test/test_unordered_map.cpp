@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+TEST_CASE("test unordered map", "[unordered_map]") {
+
+    SECTION("test insert find erase") {
+        UnorderedMap<std::string, int> m{{"one", 1}, {"two", 2}};
+        REQUIRE(m.size() == 2);
+        REQUIRE(m.at("two") == 2);
+        REQUIRE_THROWS_AS(m.at("three"), std::out_of_range);
+        REQUIRE_FALSE(m.try_emplace("one", 10).second);
+        REQUIRE(m["one"] == 1);
+        m["three"] = 3;
+        REQUIRE(m.insert_or_assign(std::string("three"), 33).second == false);
+        REQUIRE(m.find("three")->second == 33);
+        REQUIRE(m.emplace("four", 4).second);
+        REQUIRE_FALSE(m.emplace("four", 5).second);
+        REQUIRE(m.erase("two") == 1);
+        REQUIRE(m.erase("two") == 0);
+        REQUIRE_FALSE(m.contains("two"));
+        REQUIRE(m.count("four") == 1);
+        std::vector<std::string> keys;
+        for (auto const &[k, v] : m)
+            keys.push_back(k);
+        std::sort(keys.begin(), keys.end());
+        REQUIRE(keys == std::vector<std::string>{"four", "one", "three"});
+        REQUIRE(erase_if(m, [](auto const &kv) { return kv.second > 3; }) == 2);
+        REQUIRE(m.size() == 1);
+    }
+
+    SECTION("test references stay valid across rehash") {
+        UnorderedMap<int, int> m;
+        m[0] = 100;
+        int *ref = &m[0];
+        auto it = m.find(0);
+        size_t buckets = m.bucket_count();
+        for (int i = 1; i < 10000; i++)
+            m[i] = i;
+        REQUIRE(m.bucket_count() > buckets);
+        REQUIRE(m.load_factor() <= m.max_load_factor());
+        REQUIRE(ref == &m[0]);
+        REQUIRE(it->second == 100);
+        m.rehash(0); //? 收缩到刚好容纳现有元素
+        REQUIRE(&it->second == ref);
+        for (int i = 0; i < 10000; i++)
+            REQUIRE(m.contains(i));
+    }
+
+    SECTION("test buckets and load factor") {
+        UnorderedMap<int, int> m;
+        m.max_load_factor(0.5f);
+        m.reserve(100);
+        size_t buckets = m.bucket_count();
+        REQUIRE(buckets >= 200);
+        for (int i = 0; i < 100; i++)
+            m[i] = -i;
+        REQUIRE(m.bucket_count() == buckets);
+        size_t total = 0;
+        for (size_t b = 0; b < m.bucket_count(); b++)
+        {
+            size_t n = 0;
+            for (auto it = m.begin(b); it != m.end(b); ++it, ++n)
+                REQUIRE(m.bucket(it->first) == b);
+            REQUIRE(n == m.bucket_size(b));
+            total += n;
+        }
+        REQUIRE(total == 100);
+        m.max_load_factor(4.0f);
+        m.rehash(0);
+        REQUIRE(m.bucket_count() < buckets);
+        REQUIRE(m.at(42) == -42);
+    }
+
+    SECTION("test copy move swap") {
+        UnorderedMap<int, std::string> a{{1, "a"}, {2, "b"}};
+        UnorderedMap<int, std::string> b(a);
+        REQUIRE(a == b);
+        REQUIRE_FALSE(a.get_allocator() == b.get_allocator()); //? 副本有自己的节点池, 可以交给别的线程
+        b[3] = "c";
+        REQUIRE_FALSE(a == b);
+        UnorderedMap<int, std::string> c(std::move(b));
+        REQUIRE(b.empty());
+        REQUIRE(c.size() == 3);
+        b = c;
+        REQUIRE(b == c);
+        a.swap(c);
+        REQUIRE(a.size() == 3);
+        REQUIRE(c.size() == 2);
+        c = std::move(a);
+        REQUIRE(c.size() == 3);
+        REQUIRE(c.at(3) == "c");
+        a[9] = "z"; //? 被移走后仍可继续使用
+        REQUIRE(a.size() == 1);
+        c.clear();
+        REQUIRE(c.begin() == c.end());
+    }
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <miniSTL/stl.hpp>
+#include <string>
+#include <list>
+#include <random>
+#include <iterator>
+
+TEST_CASE("test unrolled list", "[unrolled_list]") {
+
+    SECTION("test push/pop and bidirectional traversal across chunks") {
+        UnrolledList<int, 64> lst;
+        REQUIRE(lst.empty());
+        for (int i = 0; i < 100; i++)
+            lst.push_back(i);
+        for (int i = 1; i <= 50; i++)
+            lst.push_front(-i);
+        REQUIRE(lst.size() == 150);
+        REQUIRE(lst.front() == -50);
+        REQUIRE(lst.back() == 99);
+        int expect = -50;
+        for (int x : lst)
+            REQUIRE(x == expect++);
+        expect = 99;
+        for (auto it = lst.rbegin(); it != lst.rend(); ++it)
+            REQUIRE(*it == expect--);
+        REQUIRE(std::distance(lst.begin(), lst.end()) == 150);
+
+        lst.pop_front();
+        lst.pop_back();
+        REQUIRE(lst.front() == -49);
+        REQUIRE(lst.back() == 98);
+        REQUIRE(lst.size() == 148);
+    }
+
+    SECTION("test insert() erase() against std::list") {
+        UnrolledList<std::string, 128> lst;
+        std::list<std::string> ref;
+        std::mt19937 rng(7);
+        for (int i = 0; i < 2000; i++)
+        {
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            auto it = std::next(lst.begin(), pos);
+            auto rit = std::next(ref.begin(), pos);
+            if (ref.empty() || rng() % 3)
+            {
+                auto ret = lst.insert(it, std::to_string(i));
+                ref.insert(rit, std::to_string(i));
+                REQUIRE(*ret == std::to_string(i));
+            }
+            else if (rit != ref.end())
+            {
+                auto ret = lst.erase(it);
+                auto rret = ref.erase(rit);
+                REQUIRE((ret == lst.end()) == (rret == ref.end()));
+                if (rret != ref.end())
+                    REQUIRE(*ret == *rret);
+            }
+        }
+        REQUIRE(lst.size() == ref.size());
+        REQUIRE(lst == UnrolledList<std::string, 128>(ref.begin(), ref.end()));
+
+        auto last = lst.erase(std::next(lst.begin(), 10), std::prev(lst.end(), 10));
+        REQUIRE(lst.size() == 20);
+        REQUIRE(*last == *std::prev(ref.end(), 10));
+    }
+
+    SECTION("test insert referencing own element and copy/move/compare") {
+        UnrolledList<std::string, 96> lst({"a", "b", "c", "d", "e", "f"});
+        for (int i = 0; i < 20; i++)
+            lst.insert(std::next(lst.begin(), 2), lst.front());
+        REQUIRE(lst.size() == 26);
+        REQUIRE(*std::next(lst.begin(), 21) == "a");
+        REQUIRE(*std::next(lst.begin(), 22) == "c");
+
+        UnrolledList<std::string, 96> cpy(lst);
+        REQUIRE(cpy == lst);
+        UnrolledList<std::string, 96> mov(std::move(cpy));
+        REQUIRE(cpy.empty());
+        REQUIRE(mov == lst);
+        mov.back() = "z";
+        REQUIRE(mov > lst);
+        mov.swap(lst);
+        REQUIRE(lst.back() == "z");
+        cpy = lst;
+        REQUIRE(cpy == lst);
+        cpy.clear();
+        REQUIRE(cpy.empty());
+        REQUIRE(cpy.begin() == cpy.end());
+    }
+}
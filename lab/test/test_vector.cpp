@@ -3,6 +3,9 @@
 #include <miniSTL/stl.hpp>
 #include <vector>
 #include <list>
+#include <string>
+#include <sstream>
+#include <iterator>
 
 struct M_int {
     int m_value;
@@ -102,4 +105,234 @@ TEST_CASE("test vector", "[vector]") {
         REQUIRE(a == a);
         REQUIRE_FALSE(a == b);
     }
+
+    SECTION("test growth policy") {
+        Vector<M_int> m_vec;
+        size_t reallocs = 0;
+        for (int i = 0; i < 1000; i++) {
+            size_t cap = m_vec.capacity();
+            m_vec.push_back(i);
+            if (m_vec.capacity() != cap)
+                reallocs++;
+        }
+        REQUIRE(reallocs <= 8);
+        for (int i = 0; i < 1000; i++)
+            REQUIRE(m_vec[i].m_value == i);
+
+        Vector<M_int, std::allocator<M_int>, GrowthChunk<16>> c_vec;
+        for (int i = 0; i < 40; i++)
+            c_vec.push_back(i);
+        REQUIRE(c_vec.capacity() == 48);
+
+        Vector<M_int, std::allocator<M_int>, GrowthOneAndHalf> h_vec;
+        for (int i = 0; i < 100; i++)
+            h_vec.insert(h_vec.begin(), i);
+        REQUIRE(h_vec.front().m_value == 99);
+        REQUIRE(h_vec.back().m_value == 0);
+    }
+
+    SECTION("test trivially relocatable insert() erase()") {
+        static_assert(is_trivially_relocatable_v<int>);
+        static_assert(is_trivially_relocatable_v<Vector<int>>);
+        static_assert(!is_trivially_relocatable_v<std::list<int>>);
+
+        Vector<Vector<int>> nested;
+        for (int i = 0; i < 100; i++)
+            nested.insert(nested.begin(), Vector<int>(3, i));
+        for (int i = 0; i < 100; i++)
+            REQUIRE(nested[i] == Vector<int>(3, 99 - i));
+        nested.erase(nested.begin() + 10, nested.begin() + 90);
+        REQUIRE(nested.size() == 20);
+        REQUIRE(nested[9] == Vector<int>(3, 90));
+        REQUIRE(nested[10] == Vector<int>(3, 9));
+        nested.shrink_to_fit();
+        REQUIRE(nested.back() == Vector<int>(3, 0));
+
+        Vector<int> ints({0, 1, 2, 3, 4, 5});
+        int arr[] = {7, 8, 9};
+        ints.insert(ints.begin() + 2, arr, arr + 3);
+        REQUIRE(ints == Vector<int>({0, 1, 7, 8, 9, 2, 3, 4, 5}));
+        ints.erase(ints.begin());
+        REQUIRE(ints == Vector<int>({1, 7, 8, 9, 2, 3, 4, 5}));
+    }
+
+    SECTION("test emplace_back() emplace() aliasing") {
+        Vector<std::string> m_vec;
+        m_vec.emplace_back(3, 'a');
+        REQUIRE(m_vec.back() == "aaa");
+        m_vec.shrink_to_fit();
+        REQUIRE(m_vec.size() == m_vec.capacity());
+        for (int i = 0; i < 10; i++) {
+            m_vec.emplace_back(m_vec[0]);
+            m_vec.push_back(m_vec.back());
+        }
+        REQUIRE(m_vec.size() == 21);
+        for (auto &str : m_vec)
+            REQUIRE(str == "aaa");
+
+        Vector<std::string> s_vec({"x", "y", "z"});
+        s_vec.shrink_to_fit();
+        s_vec.emplace(s_vec.begin() + 1, s_vec[2]);
+        REQUIRE(s_vec == Vector<std::string>({"x", "z", "y", "z"}));
+        s_vec.reserve(10);
+        s_vec.emplace(s_vec.begin(), s_vec[3]);
+        s_vec.insert(s_vec.begin() + 2, s_vec[1]);
+        REQUIRE(s_vec == Vector<std::string>({"z", "x", "x", "z", "y", "z"}));
+        s_vec.emplace(s_vec.end(), 2, 'w');
+        REQUIRE(s_vec.back() == "ww");
+    }
+
+    SECTION("test bulk fill resize_for_overwrite()") {
+        Vector<float> f_vec(1000);
+        for (float f : f_vec)
+            REQUIRE(f == 0.0f);
+        f_vec.resize(2000, 1.5f);
+        REQUIRE(f_vec[999] == 0.0f);
+        REQUIRE(f_vec[1000] == 1.5f);
+        REQUIRE(f_vec[1999] == 1.5f);
+        f_vec.resize(3000, f_vec[1000]);
+        REQUIRE(f_vec[2999] == 1.5f);
+
+        Vector<char> c_vec(100, 'x');
+        REQUIRE(c_vec[99] == 'x');
+        c_vec.assign(10, c_vec[0]);
+        REQUIRE(c_vec.size() == 10);
+        REQUIRE(c_vec[9] == 'x');
+
+        Vector<int> i_vec;
+        i_vec.resize_for_overwrite(500);
+        REQUIRE(i_vec.size() == 500);
+        for (int i = 0; i < 500; i++)
+            i_vec[i] = i;
+        REQUIRE(i_vec[499] == 499);
+
+        Vector<std::string> s_vec(2, "ab");
+        s_vec.assign(4, s_vec[1]);
+        s_vec.resize_for_overwrite(6);
+        REQUIRE(s_vec[3] == "ab");
+        REQUIRE(s_vec[5].empty());
+    }
+
+    SECTION("test MmapAllocator reallocate") {
+        //? 阈值 4KB, 覆盖 malloc -> malloc, malloc -> mmap, mmap -> mmap 以及收缩回 malloc 的路径
+        Vector<long long, MmapAllocator<long long, 4096>> m_vec;
+        for (long long i = 0; i < 100000; i++)
+            m_vec.push_back(i);
+        for (long long i = 0; i < 100000; i++)
+            REQUIRE(m_vec[i] == i);
+        m_vec.emplace_back(m_vec[0]);
+        REQUIRE(m_vec.back() == 0);
+        m_vec.reserve(1 << 20);
+        REQUIRE(m_vec.capacity() == 1 << 20);
+        REQUIRE(m_vec[99999] == 99999);
+        m_vec.resize(100);
+        m_vec.shrink_to_fit();
+        REQUIRE(m_vec.capacity() == 100);
+        for (long long i = 0; i < 100; i++)
+            REQUIRE(m_vec[i] == i);
+    }
+
+    SECTION("test AlignedAllocator HugePageAllocator") {
+        Vector<float, AlignedAllocator<float, 64>> a_vec(37, 1.0f);
+        static_assert(decltype(a_vec)::alignment == 64);
+        static_assert(Vector<double>::alignment == alignof(double));
+        REQUIRE(reinterpret_cast<uintptr_t>(a_vec.data()) % 64 == 0);
+        for (int i = 0; i < 1000; i++) {
+            a_vec.push_back((float)i);
+            REQUIRE(reinterpret_cast<uintptr_t>(a_vec.data()) % 64 == 0);
+        }
+        REQUIRE(a_vec[36] == 1.0f);
+        REQUIRE(a_vec.back() == 999.0f);
+
+        Vector<float, HugePageAllocator<float>> h_vec(1 << 20, 2.0f);
+        REQUIRE(reinterpret_cast<uintptr_t>(h_vec.data()) % HugePageAllocator<float>::huge_page_size == 0);
+        h_vec.push_back(3.0f);
+        REQUIRE(reinterpret_cast<uintptr_t>(h_vec.data()) % HugePageAllocator<float>::huge_page_size == 0);
+        REQUIRE(h_vec[(1 << 20) - 1] == 2.0f);
+        REQUIRE(h_vec.back() == 3.0f);
+
+        List<double, AlignedAllocator<double, 32>> a_lst({1.0, 2.0, 3.0});
+        a_lst.push_back(4.0);
+        REQUIRE(a_lst.back() == 4.0);
+        List<int, HugePageAllocator<int>> h_lst(3, 7);
+        REQUIRE(h_lst.front() == 7);
+    }
+
+    SECTION("test operator<=>") {
+        Vector<int> a({0, 1, 2, 3, 4, 5});
+        Vector<int> b({0, 1, 2, 3, 4, 6});
+        Vector<int> c({0, 1, 2});
+        REQUIRE(a < b);
+        REQUIRE(c < a);
+        REQUIRE((a <=> a) == std::strong_ordering::equal);
+        REQUIRE(Vector<int>({-1}) < Vector<int>({0}));
+
+        Vector<long long> big(1000, 7);
+        Vector<long long> big2(big);
+        REQUIRE(big == big2);
+        big2[777] = 8;
+        REQUIRE_FALSE(big == big2);
+        REQUIRE(big < big2);
+        big2[100] = -1;
+        REQUIRE(big > big2);
+
+        Vector<double> d({0.0, 1.0});
+        REQUIRE(d == Vector<double>({-0.0, 1.0}));
+        REQUIRE((d <=> Vector<double>({0.0, 2.0})) == std::partial_ordering::less);
+
+        Vector<std::string> s({"ab", "c"});
+        REQUIRE(s < Vector<std::string>({"ab", "d"}));
+    }
+
+    SECTION("test insert() assign() from any iterator category") {
+        std::list<int> lst({1, 2, 3});
+        Vector<int> m_vec(lst.begin(), lst.end());
+        REQUIRE(m_vec == Vector<int>({1, 2, 3}));
+        REQUIRE(m_vec.capacity() == 3);
+
+        m_vec.insert(m_vec.begin() + 1, lst.begin(), lst.end());
+        REQUIRE(m_vec == Vector<int>({1, 1, 2, 3, 2, 3}));
+
+        std::istringstream in("7 8 9");
+        m_vec.insert(m_vec.begin(), std::istream_iterator<int>(in), std::istream_iterator<int>());
+        REQUIRE(m_vec == Vector<int>({7, 8, 9, 1, 1, 2, 3, 2, 3}));
+
+        std::istringstream in2("4 5");
+        m_vec.assign(std::istream_iterator<int>(in2), std::istream_iterator<int>());
+        REQUIRE(m_vec == Vector<int>({4, 5}));
+
+        m_vec.reserve(20);
+        m_vec.insert(m_vec.begin() + 1, 3, m_vec[1]);
+        REQUIRE(m_vec == Vector<int>({4, 5, 5, 5, 5}));
+        m_vec.insert(m_vec.end(), 30, -1);
+        REQUIRE(m_vec.size() == 35);
+        REQUIRE(m_vec[34] == -1);
+
+        Vector<std::string> s_vec({"a", "b"});
+        std::list<std::string> s_lst({"x", "y", "z"});
+        s_vec.insert(s_vec.begin() + 1, s_lst.begin(), s_lst.end());
+        REQUIRE(s_vec == Vector<std::string>({"a", "x", "y", "z", "b"}));
+        s_vec.insert(s_vec.begin(), 2, s_vec[4]);
+        REQUIRE(s_vec == Vector<std::string>({"b", "b", "a", "x", "y", "z", "b"}));
+        s_vec.assign(s_lst.begin(), s_lst.end());
+        REQUIRE(s_vec == Vector<std::string>({"x", "y", "z"}));
+    }
+
+    SECTION("test remove_if() remove() unique() erase_if()") {
+        Vector<int> m_vec({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        REQUIRE(erase_if(m_vec, [](int x) { return x % 3 == 0; }) == 4);
+        REQUIRE(m_vec == Vector<int>({1, 2, 4, 5, 7, 8}));
+        REQUIRE(m_vec.remove_if([](int x) { return x > 100; }) == 0);
+        REQUIRE(m_vec.size() == 6);
+
+        Vector<std::string> s_vec({"a", "b", "a", "c", "a"});
+        REQUIRE(s_vec.remove(s_vec[0]) == 3);
+        REQUIRE(s_vec == Vector<std::string>({"b", "c"}));
+
+        Vector<int> u_vec({1, 1, 2, 2, 2, 3, 1, 1});
+        REQUIRE(u_vec.unique() == 4);
+        REQUIRE(u_vec == Vector<int>({1, 2, 3, 1}));
+        REQUIRE(erase(u_vec, 1) == 2);
+        REQUIRE(u_vec == Vector<int>({2, 3}));
+    }
 }